@@ -134,6 +134,8 @@ ov_dependent_option (ENABLE_PLUGINS_XML "Generate plugins.xml configuration file
 
 ov_dependent_option (ENABLE_FUNCTIONAL_TESTS "functional tests" ON "ENABLE_TESTS" OFF)
 
+ov_dependent_option (ENABLE_MICROBENCHMARKS "microbenchmarks of the CPU plugin nodes and core kernels" OFF "ENABLE_TESTS" OFF)
+
 ov_option (ENABLE_SAMPLES "console samples are part of OpenVINO Runtime package" ON)
 
 set(OPENVINO_EXTRA_MODULES "" CACHE STRING "Extra paths for extra modules to include into OpenVINO build")
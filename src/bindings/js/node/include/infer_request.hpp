@@ -4,23 +4,13 @@
 #pragma once
 #include <napi.h>
 
-#include <thread>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
 
 #include "openvino/runtime/infer_request.hpp"
 
-struct TsfnContext {
-    TsfnContext(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)), _ir(nullptr) {};
-
-    std::thread native_thread;
-
-    Napi::Promise::Deferred deferred;
-    Napi::ThreadSafeFunction tsfn;
-
-    ov::InferRequest* _ir;
-    std::vector<ov::Tensor> _inputs;
-    std::map<std::string, ov::Tensor> result;
-};
-
 class InferRequestWrap : public Napi::ObjectWrap<InferRequestWrap> {
 public:
     /**
@@ -28,6 +18,7 @@ public:
      * @param info contains passed arguments. Can be empty.
      */
     InferRequestWrap(const Napi::CallbackInfo& info);
+    ~InferRequestWrap();
     /**
      * @brief Defines a Javascript InferRequest class with constructor, static and instance properties and methods.
      * @param env The environment in which to construct a JavaScript class.
@@ -35,14 +26,16 @@ public:
      */
     static Napi::Function get_class(Napi::Env env);
 
-    void set_infer_request(const ov::InferRequest& infer_request);
+    void set_infer_request(const ov::InferRequest& infer_request, bool owns_request = true);
     /**
      * @brief Creates JavaScript InferRequest object and wraps inside of it ov::InferRequest object.
      * @param env The environment in which to construct a JavaScript object.
      * @param infer_request ov::InferRequest to wrap.
+     * @param owns_request false if the request and its callback are owned by another object, e.g. AsyncInferQueue,
+     * then inferAsync() isn't available.
      * @return Javascript InferRequest as Napi::Object. (Not InferRequestWrap object)
      */
-    static Napi::Object wrap(Napi::Env env, ov::InferRequest infer_request);
+    static Napi::Object wrap(Napi::Env env, ov::InferRequest infer_request, bool owns_request = true);
 
     /**
      * @brief Sets an input/output tensor to infer on.
@@ -119,9 +112,34 @@ public:
     Napi::Value get_compiled_model(const Napi::CallbackInfo& info);
 
 private:
-    ov::InferRequest _infer_request;
-};
+    /** @brief The inputs and the promise of an inferAsync() call waiting for its turn. */
+    struct AsyncCall {
+        std::vector<ov::Tensor> inputs;
+        Napi::ObjectReference js_inputs;  // to prevent garbage collection
+        Napi::Promise::Deferred deferred;
+    };
+
+    /** @brief The outputs or the error of the finished asynchronous inference. */
+    struct AsyncResult {
+        std::map<std::string, ov::Tensor> outputs;
+        std::string error;
+    };
+
+    /**
+     * @brief Starts ov::InferRequest::start_async() for the oldest pending inferAsync() call.
+     * The calls of the request are started one by one from the main event loop, no thread is created.
+     */
+    void start_pending_async(Napi::Env env);
 
-void FinalizerCallback(Napi::Env env, void* finalizeData, TsfnContext* context);
+    /** @brief Creates the ThreadSafeFunction and the ov::InferRequest callback on the first inferAsync() call. */
+    void init_async(Napi::Env env);
 
-void performInferenceThread(TsfnContext* context);
+    ov::InferRequest _infer_request;
+    // the callback of a request which isn't owned by the wrapper is never replaced
+    bool _owns_request = true;
+    // accessed from the main event loop only
+    std::queue<AsyncCall> _async_calls;
+    bool _async_running = false;
+    bool _async_referenced = false;
+    Napi::ThreadSafeFunction _async_tsfn;
+};
@@ -538,6 +538,7 @@ export interface InferRequest {
    * @param inputData An object with the key-value pairs where the key is the
    * input name and value is a tensor or an array with tensors. If the model has
    * multiple inputs, the Tensors must be passed in the correct order.
+   * The calls on the same InferRequest are queued and run one by one.
    */
   inferAsync(
     inputData: { [inputName: string]: Tensor } | Tensor[],
@@ -111,7 +111,8 @@ void AsyncInferQueue::set_custom_callbacks(const Napi::CallbackInfo& info) {
                         std::rethrow_exception(exception_ptr);
                     }
                     auto ov_callback = [this, handle](Napi::Env env, Napi::Function user_callback) {
-                        Napi::Object js_ir = InferRequestWrap::wrap(env, m_requests[handle]);
+                        // the queue owns the request and its callback
+                        Napi::Object js_ir = InferRequestWrap::wrap(env, m_requests[handle], false);
                         const auto promise = m_user_ids[handle].second;
                         try {
                             auto user_data =
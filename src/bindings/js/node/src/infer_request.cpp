@@ -3,7 +3,10 @@
 
 #include "node/include/infer_request.hpp"
 
-#include <mutex>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <utility>
 
 #include "node/include/addon.hpp"
 #include "node/include/compiled_model.hpp"
@@ -12,14 +15,18 @@
 #include "node/include/node_output.hpp"
 #include "node/include/tensor.hpp"
 
-namespace {
-std::mutex infer_mutex;
-}
-
 InferRequestWrap::InferRequestWrap(const Napi::CallbackInfo& info)
     : Napi::ObjectWrap<InferRequestWrap>(info),
       _infer_request{} {}
 
+InferRequestWrap::~InferRequestWrap() {
+    if (_owns_request && _async_tsfn) {
+        // the callback installed by this wrapper must not outlive it
+        _infer_request.set_callback([](std::exception_ptr) {});
+        _async_tsfn.Release();
+    }
+}
+
 Napi::Function InferRequestWrap::get_class(Napi::Env env) {
     return DefineClass(env,
                        "InferRequest",
@@ -36,18 +43,19 @@ Napi::Function InferRequestWrap::get_class(Napi::Env env) {
                        });
 }
 
-void InferRequestWrap::set_infer_request(const ov::InferRequest& infer_request) {
+void InferRequestWrap::set_infer_request(const ov::InferRequest& infer_request, bool owns_request) {
     _infer_request = infer_request;
+    _owns_request = owns_request;
 }
 
-Napi::Object InferRequestWrap::wrap(Napi::Env env, ov::InferRequest infer_request) {
+Napi::Object InferRequestWrap::wrap(Napi::Env env, ov::InferRequest infer_request, bool owns_request) {
     const auto& prototype = env.GetInstanceData<AddonData>()->infer_request;
     if (!prototype) {
         OPENVINO_THROW("Invalid pointer to InferRequest prototype.");
     }
     auto obj = prototype.New({});
     const auto ir = Napi::ObjectWrap<InferRequestWrap>::Unwrap(obj);
-    ir->set_infer_request(infer_request);
+    ir->set_infer_request(infer_request, owns_request);
     return obj;
 }
 
@@ -194,64 +202,98 @@ void InferRequestWrap::infer(const Napi::Object& inputs) {
 Napi::Value InferRequestWrap::get_compiled_model(const Napi::CallbackInfo& info) {
     return CompiledModelWrap::wrap(info.Env(), _infer_request.get_compiled_model());
 }
-void FinalizerCallback(Napi::Env env, void* finalizeData, TsfnContext* context) {
-    context->native_thread.join();
-    delete context;
-};
 
-void performInferenceThread(TsfnContext* context) {
-    {
-        const std::lock_guard<std::mutex> lock(infer_mutex);
-        for (size_t i = 0; i < context->_inputs.size(); ++i) {
-            context->_ir->set_input_tensor(i, context->_inputs[i]);
+void InferRequestWrap::init_async(Napi::Env env) {
+    _async_tsfn = Napi::ThreadSafeFunction::New(env, Napi::Function(), "InferRequestAsync", 0, 1);
+    _async_tsfn.Unref(env);
+    _infer_request.set_callback([this](std::exception_ptr exception_ptr) {
+        // runs in the thread of the device, the outputs are copied here to keep the main event loop free
+        auto result = std::make_unique<AsyncResult>();
+        try {
+            if (exception_ptr) {
+                std::rethrow_exception(exception_ptr);
+            }
+            for (const auto& node : _infer_request.get_compiled_model().outputs()) {
+                const auto& tensor = _infer_request.get_tensor(node);
+                auto new_tensor = ov::Tensor(tensor.get_element_type(), tensor.get_shape());
+                tensor.copy_to(new_tensor);
+                result->outputs.insert({node.get_any_name(), new_tensor});
+            }
+        } catch (const std::exception& e) {
+            result->error = e.what();
         }
-        context->_ir->infer();
-
-        auto compiled_model = context->_ir->get_compiled_model().outputs();
-        std::map<std::string, ov::Tensor> outputs;
 
-        for (auto& node : compiled_model) {
-            const auto& tensor = context->_ir->get_tensor(node);
-            auto new_tensor = ov::Tensor(tensor.get_element_type(), tensor.get_shape());
-            tensor.copy_to(new_tensor);
-            outputs.insert({node.get_any_name(), new_tensor});
+        auto js_callback = [this](Napi::Env env, Napi::Function, AsyncResult* data) {
+            std::unique_ptr<AsyncResult> result(data);
+            auto call = std::move(_async_calls.front());
+            _async_calls.pop();
+            if (result->error.empty()) {
+                auto outputs_obj = Napi::Object::New(env);
+                for (const auto& [key, tensor] : result->outputs) {
+                    outputs_obj.Set(key, TensorWrap::wrap(env, tensor));
+                }
+                call.deferred.Resolve(outputs_obj);
+            } else {
+                call.deferred.Reject(Napi::Error::New(env, result->error).Value());
+            }
+            _async_running = false;
+            start_pending_async(env);
+        };
+        // runs in the thread of the device, so the failure is reported without throwing. The call fails only
+        // when the environment is being torn down, and then the promise can't be settled anyway
+        if (_async_tsfn.NonBlockingCall(result.get(), js_callback) == napi_ok) {
+            result.release();
+        } else {
+            std::cerr << "Failed to pass the inferAsync() result to the main event loop." << std::endl;
         }
+    });
+}
 
-        context->result = outputs;
-    }
-
-    auto callback = [](Napi::Env env, Napi::Function, TsfnContext* context) {
-        const auto& res = context->result;
-        auto outputs_obj = Napi::Object::New(env);
-
-        for (const auto& [key, tensor] : res) {
-            outputs_obj.Set(key, TensorWrap::wrap(env, tensor));
+void InferRequestWrap::start_pending_async(Napi::Env env) {
+    while (!_async_running && !_async_calls.empty()) {
+        auto& call = _async_calls.front();
+        try {
+            for (size_t i = 0; i < call.inputs.size(); ++i) {
+                _infer_request.set_input_tensor(i, call.inputs[i]);
+            }
+            _infer_request.start_async();
+            _async_running = true;
+        } catch (const std::exception& e) {
+            call.deferred.Reject(Napi::Error::New(env, e.what()).Value());
+            _async_calls.pop();
         }
-        context->deferred.Resolve(outputs_obj);
-    };
-
-    context->tsfn.BlockingCall(context, callback);
-    context->tsfn.Release();
+    }
+    // keeps the event loop and this object alive while the inference is running
+    if (_async_running && !_async_referenced) {
+        _async_tsfn.Ref(env);
+        Ref();
+        _async_referenced = true;
+    } else if (!_async_running && _async_referenced) {
+        _async_tsfn.Unref(env);
+        Unref();
+        _async_referenced = false;
+    }
 }
 
 Napi::Value InferRequestWrap::infer_async(const Napi::CallbackInfo& info) {
-    if (info.Length() != 1) {
-        reportError(info.Env(), "InferAsync method takes as an argument an array or an object.");
-    }
     Napi::Env env = info.Env();
-
-    auto context = new TsfnContext(env);
-    context->_ir = &_infer_request;
     try {
-        auto parsed_input = parse_input_data(info[0]);
-        context->_inputs = parsed_input;
+        OPENVINO_ASSERT(info.Length() == 1, "InferAsync method takes as an argument an array or an object.");
+        OPENVINO_ASSERT(_owns_request,
+                        "InferAsync method can't be called on the request of AsyncInferQueue, "
+                        "use AsyncInferQueue.startAsync() instead.");
+        auto inputs = parse_input_data(info[0]);
+        auto deferred = Napi::Promise::Deferred::New(env);
+        _async_calls.push({std::move(inputs), Napi::Persistent(info[0].ToObject()), deferred});
+        if (!_async_tsfn) {
+            init_async(env);
+        }
+        if (!_async_running) {
+            start_pending_async(env);
+        }
+        return deferred.Promise();
     } catch (std::exception& e) {
-        reportError(info.Env(), e.what());
+        reportError(env, e.what());
+        return env.Undefined();
     }
-
-    context->tsfn =
-        Napi::ThreadSafeFunction::New(env, Napi::Function(), "TSFN", 0, 1, context, FinalizerCallback, (void*)nullptr);
-
-    context->native_thread = std::thread(performInferenceThread, context);
-    return context->deferred.Promise();
 }
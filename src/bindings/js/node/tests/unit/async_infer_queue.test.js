@@ -217,4 +217,62 @@ describe("Tests for AsyncInferQueue.", () => {
     });
     inferQueue.release();
   });
+
+  it("Test inferAsync() on the request of AsyncInferQueue keeps the queue callback", async () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, numRequest);
+    const results = Array(jobs).fill(null);
+
+    function callback(err, request, jobId) {
+      assert.ifError(err);
+      assert.throws(() => {
+        request.inferAsync([generateImage()]);
+      }, /InferAsync method can't be called on the request of AsyncInferQueue/);
+      results[jobId] = request.getOutputTensor().data[0];
+    }
+
+    inferQueue.setCallback(callback);
+    // the second round proves the queue callbacks survived the wrappers of the first one
+    for (let round = 1; round <= 2; round++) {
+      const promises = [];
+      for (let i = 0; i < jobs; i++) {
+        const img = generateImage();
+        img[0] = round * i;
+        promises.push(inferQueue.startAsync({ data: img }, i));
+      }
+      await Promise.all(promises);
+      assert.deepStrictEqual(
+        results,
+        Array.from({ length: jobs }, (_, i) => round * i),
+      );
+    }
+    inferQueue.release();
+  });
+
+  it("Test AsyncInferQueue and inferAsync() survive garbage collection", async () => {
+    require("v8").setFlagsFromString("--expose-gc");
+    const gc = require("vm").runInNewContext("gc");
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, numRequest);
+    let jobsDone = 0;
+    inferQueue.setCallback((err) => {
+      assert.ifError(err);
+      jobsDone++;
+    });
+
+    for (let round = 0; round < 3; round++) {
+      const queued = Array.from({ length: jobs }, (_, i) =>
+        inferQueue.startAsync({ data: generateImage() }, i),
+      );
+      // the wrapper of a finished request is collectable while its inference results are pending
+      const img = generateImage();
+      img[0] = round + 1;
+      const owned = compiledModel.createInferRequest().inferAsync([img]);
+      gc();
+      const [output] = Object.values(await owned);
+      assert.strictEqual(output.data[0], round + 1);
+      await Promise.all(queued);
+      gc();
+    }
+    assert.strictEqual(jobsDone, 3 * jobs);
+    inferQueue.release();
+  });
 });
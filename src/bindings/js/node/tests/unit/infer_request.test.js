@@ -129,6 +129,16 @@ describe("ov.InferRequest tests", () => {
         /Cannot create a tensor from the passed Napi::Value./,
       );
     });
+
+    it("Test inferAsync() calls on the same request run one by one", async () => {
+      const expected = inferRequest.infer([tensor])["fc_out"].data;
+      const results = await Promise.all(
+        Array.from({ length: 8 }, () => inferRequest.inferAsync([tensor])),
+      );
+      for (const result of results) {
+        assert.deepStrictEqual(result["fc_out"].data, expected);
+      }
+    });
   });
 
   describe("BigInt InferRequest support", () => {
@@ -5,7 +5,7 @@ import typing
 """
 openvino.properties.intel_cpu submodule that simulates ov::intel_cpu
 """
-__all__: list[str] = ['TbbPartitioner', 'denormals_optimization', 'sparse_weights_decompression_rate', 'tbb_partitioner']
+__all__: list[str] = ['TbbPartitioner', 'denormals_optimization', 'infer_request_priority', 'runtime_trace_path', 'sparse_weights_decompression_rate', 'tbb_partitioner']
 class TbbPartitioner:
     """
     Members:
@@ -58,6 +58,18 @@ def denormals_optimization() -> str:
 def denormals_optimization(arg0: bool) -> tuple[str, openvino._pyopenvino.OVAny]:
     ...
 @typing.overload
+def infer_request_priority() -> str:
+    ...
+@typing.overload
+def infer_request_priority(arg0: openvino._pyopenvino.properties.hint.Priority) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
+def runtime_trace_path() -> str:
+    ...
+@typing.overload
+def runtime_trace_path(arg0: str) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
 def sparse_weights_decompression_rate() -> str:
     ...
 @typing.overload
@@ -118,6 +118,8 @@ void regmodule_properties(py::module m) {
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
     wrap_property_RW(m_intel_cpu, ov::intel_cpu::tbb_partitioner, "tbb_partitioner");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::infer_request_priority, "infer_request_priority");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::runtime_trace_path, "runtime_trace_path");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
@@ -372,6 +372,16 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (2.0, 2.0),
             ),
         ),
+        (
+            intel_cpu.infer_request_priority,
+            "CPU_INFER_REQUEST_PRIORITY",
+            ((hints.Priority.HIGH, hints.Priority.HIGH),),
+        ),
+        (
+            intel_cpu.runtime_trace_path,
+            "CPU_RUNTIME_TRACE_PATH",
+            (("/tmp/cpu_trace", "/tmp/cpu_trace"),),
+        ),
         (
             intel_cpu.tbb_partitioner,
             "TBB_PARTITIONER",
@@ -19,6 +19,9 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): 1D tensor with the index of the adapter of each batch row.
+ *    If it is present, `LoRA_matrices` are banks of the matrices of several adapters stacked along
+ *    the first axis, and the body gathers the matrices of each row from the banks.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
@@ -18,8 +18,15 @@ class TRANSFORMATIONS_API LoraSubgraphFusion;
 }  // namespace pass
 }  // namespace ov
 
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief LoraSubgraphFusion fuses the LoRA subgraph into LoraSubgraph operation.
+ * @param allow_adapter_banks enables the fusion of the multi-adapter LoRA subgraphs, whose matrices are gathered
+ * per batch row from the banks of the matrices of several adapters. Such LoraSubgraph has the additional input
+ * with the adapter indices.
+ */
 class ov::pass::LoraSubgraphFusion : public ov::pass::MatcherPass {
 public:
     OPENVINO_MATCHER_PASS_RTTI("LoraSubgraphFusion");
-    LoraSubgraphFusion();
+    explicit LoraSubgraphFusion(bool allow_adapter_banks = false);
 };
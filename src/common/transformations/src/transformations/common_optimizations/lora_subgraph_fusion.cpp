@@ -11,6 +11,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/convolution.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
@@ -21,24 +22,32 @@
 #include "ov_ops/lora_subgraph.hpp"
 #include "transformations/utils/utils.hpp"
 
-ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
+ov::pass::LoraSubgraphFusion::LoraSubgraphFusion(bool allow_adapter_banks) {
     MATCHER_SCOPE(LoraSubgraphFusion);
     using namespace pass::pattern;
     auto lora_input_m = any_input();
     auto transpose_const1_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose1_m = optional<ov::op::v1::Transpose>({lora_input_m, transpose_const1_m}, consumers_count(1));
 
+    // In the multi-adapter case the states hold banks of the LoRA matrices of several adapters,
+    // and the matrices of each batch row are gathered from the banks by the adapter indices
+    auto adapter_indices_m = any_input(rank_equals(1));
+    auto gather_axis_m = wrap_type<ov::op::v0::Constant>(value_matches("0"));
+
     auto read_value1_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert1_m = optional<ov::op::v0::Convert>(read_value1_m, consumers_count(1));
-    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, convert1_m}, consumers_count(1));
+    auto gather1_m = optional<ov::op::v8::Gather>({convert1_m, adapter_indices_m, gather_axis_m}, consumers_count(1));
+    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({transpose1_m, gather1_m}, consumers_count(1));
 
     auto read_value2_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert2_m = optional<ov::op::v0::Convert>(read_value2_m, consumers_count(1));
-    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, convert2_m}, consumers_count(1));
+    auto gather2_m = optional<ov::op::v8::Gather>({convert2_m, adapter_indices_m, gather_axis_m}, consumers_count(1));
+    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, gather2_m}, consumers_count(1));
 
     auto read_value3_m = wrap_type<ov::op::util::ReadValueBase>();
     auto convert3_m = optional<ov::op::v0::Convert>(read_value3_m, consumers_count(1));
-    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, convert3_m}, consumers_count(1));
+    auto gather3_m = optional<ov::op::v8::Gather>({convert3_m, adapter_indices_m, gather_axis_m}, consumers_count(1));
+    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, gather3_m}, consumers_count(1));
 
     auto transpose_const2_m = wrap_type<ov::op::v0::Constant>(consumers_count(1));
     auto transpose2_m = optional<ov::op::v1::Transpose>({matmul2_m, transpose_const2_m}, consumers_count(1));
@@ -65,6 +74,23 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
             return false;
         }
 
+        const auto gathers_count = pattern_map.count(gather1_m) + pattern_map.count(gather2_m) +
+                                   pattern_map.count(gather3_m);
+        // either all the LoRA matrices are taken from the adapter banks, or none of them
+        if (gathers_count != 0 && (!allow_adapter_banks || gathers_count != 3)) {
+            return false;
+        }
+        const bool multi_adapter = gathers_count == 3;
+        if (multi_adapter) {
+            for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+                const auto gather = ov::as_type<ov::op::v8::Gather>(pattern_map.at(gather_m).get_node());
+                // all the matrices must be gathered by the same adapter indices
+                if (gather->get_batch_dims() != 0 || gather->input_value(1) != pattern_map.at(adapter_indices_m)) {
+                    return false;
+                }
+            }
+        }
+
         auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
             for (size_t i = 0; i < child->get_input_size(); ++i) {
                 auto input = child->input(i);
@@ -75,30 +101,52 @@ ov::pass::LoraSubgraphFusion::LoraSubgraphFusion() {
         };
 
         // Note: internal_inputs/external_connections order corresponds to LoraSubgraph semantic
-        const std::vector<ov::Input<ov::Node>> internal_inputs{
+        std::vector<ov::Input<ov::Node>> internal_inputs{
             // For commutative eltwise ops, input idx may be any, so it must be computed
             find_connected_input(add.get_node(), main_flow.get_node()),
             pattern_map.count(transpose1_m) ? pattern_map.at(transpose1_m).get_node()->input(0)
                                             : matmul1.get_node()->input(0),
-            matmul1.get_node()->input(1),
-            find_connected_input(multiply.get_node(), state_2.get_node()),
-            matmul2.get_node()->input(1),
         };
-        const ov::OutputVector external_connections{
+        ov::OutputVector external_connections{
             main_flow,
             lora_input,
             state_1,
             state_2,
             state_3,
         };
+        std::vector<ov::Node*> gathers;
+        if (multi_adapter) {
+            // the matrices are gathered from the adapter banks inside the subgraph
+            for (const auto& gather_m : {gather1_m, gather2_m, gather3_m}) {
+                gathers.push_back(pattern_map.at(gather_m).get_node());
+                internal_inputs.push_back(gathers.back()->input(0));
+            }
+            external_connections.push_back(pattern_map.at(adapter_indices_m));
+        } else {
+            internal_inputs.push_back(matmul1.get_node()->input(1));
+            internal_inputs.push_back(find_connected_input(multiply.get_node(), state_2.get_node()));
+            internal_inputs.push_back(matmul2.get_node()->input(1));
+        }
 
         ov::ParameterVector subgraph_parameters;
-        subgraph_parameters.reserve(internal_inputs.size());
+        subgraph_parameters.reserve(external_connections.size());
         for (auto& in : internal_inputs) {
             auto new_parameter = std::make_shared<ov::op::v0::Parameter>(in.get_element_type(), in.get_partial_shape());
             subgraph_parameters.push_back(new_parameter);
             in.replace_source_output(new_parameter);
         }
+        if (multi_adapter) {
+            const auto& indices = pattern_map.at(adapter_indices_m);
+            auto indices_parameter =
+                std::make_shared<ov::op::v0::Parameter>(indices.get_element_type(), indices.get_partial_shape());
+            subgraph_parameters.push_back(indices_parameter);
+            const auto& axis = pattern_map.at(gather_axis_m).get_node_shared_ptr();
+            for (auto* gather : gathers) {
+                gather->input(1).replace_source_output(indices_parameter);
+                // the axis constant may be shared with the nodes outside the subgraph
+                gather->input(2).replace_source_output(axis->clone_with_new_inputs({}));
+            }
+        }
         // Note: lora consumers should be taken before lora_subgraph creation,
         // because only original consumers should be replaced with lora's output
         const auto& lora_consumers = add.get_target_inputs();
@@ -12,6 +12,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -225,6 +226,107 @@ TEST_F(LoraSubgraphFusionMatMulTests, ReshaffledEltwiseInputs) {
     }
 }
 
+class LoraSubgraphFusionMultiAdapterTests : public LoraSubgraphFusionMatMulTests {
+public:
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<ov::pass::LoraSubgraphFusion>(true);
+    }
+};
+
+TEST_F(LoraSubgraphFusionMultiAdapterTests, MultiAdapterPattern) {
+    // the states are banks of the LoRA matrices, the matrices of each batch row are gathered by the adapter index
+    const ov::PartialShape shape_bank_1 = {-1, -1, K};
+    const ov::PartialShape shape_bank_2 = {-1, 1, -1};
+    const ov::PartialShape shape_bank_3 = {-1, N, -1};
+    const ov::PartialShape shape_indices = {-1};
+    auto gather_banks = [](const ov::OutputVector& banks, const ov::Output<ov::Node>& indices) {
+        ov::OutputVector matrices;
+        for (const auto& bank : banks) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            matrices.push_back(std::make_shared<ov::op::v8::Gather>(bank, indices, axis));
+        }
+        return matrices;
+    };
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3});
+        auto lora_subgraph =
+            create_lora_subgraph(main_mm, param_lora, gather_banks(states.first, param_indices), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        states.second,
+                                        ParameterVector{param_lora, param_w, param_indices});
+    }
+    {
+        auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto inner_bank_1 = std::make_shared<ov::op::v0::Parameter>(netType, shape_bank_1);
+        auto inner_bank_2 = std::make_shared<ov::op::v0::Parameter>(netType, shape_bank_2);
+        auto inner_bank_3 = std::make_shared<ov::op::v0::Parameter>(netType, shape_bank_3);
+        auto inner_param_mm = std::make_shared<ov::op::v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, shape_indices);
+
+        ov::OutputVector banks_outs{inner_bank_1, inner_bank_2, inner_bank_3};
+        auto lora_subgraph =
+            create_lora_subgraph(inner_param_mm, inner_param_lora, gather_banks(banks_outs, inner_indices), false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_bank_1,
+                                         inner_bank_2,
+                                         inner_bank_3,
+                                         inner_indices};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3});
+        ov::OutputVector lora_inputs{main_mm,
+                                     param_lora,
+                                     states.first[0],
+                                     states.first[1],
+                                     states.first[2],
+                                     param_indices};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            states.second,
+                                            ParameterVector{param_lora, param_w, param_indices});
+    }
+}
+
+TEST_F(LoraSubgraphFusionMultiAdapterTests, DifferentIndicesNotFused) {
+    // the matrices gathered by the different indices don't form a LoRA of the adapters bank
+    auto param_lora = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+    auto param_indices_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto param_indices_2 = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(param_lora, param_w, false, true);
+    const ov::PartialShape shape_bank_1 = {-1, -1, K};
+    const ov::PartialShape shape_bank_2 = {-1, 1, -1};
+    const ov::PartialShape shape_bank_3 = {-1, N, -1};
+    auto states = create_states({shape_bank_1, shape_bank_2, shape_bank_3});
+    ov::OutputVector matrices;
+    for (size_t i = 0; i < states.first.size(); i++) {
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        const auto& indices = i == 1 ? param_indices_2 : param_indices_1;
+        matrices.push_back(std::make_shared<ov::op::v8::Gather>(states.first[i], indices, axis));
+    }
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, matrices, false);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    states.second,
+                                    ParameterVector{param_lora, param_w, param_indices_1, param_indices_2});
+}
+
 class LoraSubgraphFusionConvolutionTests : public LoraSubgraphFusionTests {
 public:
     const ov::Dimension num_channels = 320;
@@ -95,6 +95,9 @@ public:
     /**
      * @brief Copy tensor, destination tensor should have the same element type and shape
      *
+     * The destination tensor of a host memory may have another element type if the conversion is supported:
+     * f32 <-> f16, f32 <-> bf16, bf16 -> f16, u8 -> f32 and u8 -> f16. The elements are converted during the copy.
+     *
      * @param dst destination tensor
      */
     virtual void copy_to(const std::shared_ptr<ov::ITensor>& dst) const;
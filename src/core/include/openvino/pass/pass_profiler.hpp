@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+/// \brief Compile-time statistics of a transformation pass accumulated over all its runs
+/// \ingroup ov_pass_cpp_api
+struct PassProfile {
+    /// \brief Name of the pass::Manager which ran the pass
+    std::string manager;
+    /// \brief Name of the pass. A MatcherPass run by a GraphRewrite is named "<GraphRewrite>/<MatcherPass>"
+    std::string name;
+    /// \brief Number of times the pass was run. For a MatcherPass it is the number of nodes it was tried on
+    size_t runs = 0;
+    /// \brief Number of runs which changed the model. For a MatcherPass it is the number of fired callbacks
+    size_t applied = 0;
+    /// \brief Number of nodes visited by a GraphRewrite, zero for the passes which don't report it
+    size_t nodes_visited = 0;
+    /// \brief Wall time spent in the pass, including the nested passes
+    std::chrono::nanoseconds time{0};
+};
+
+/// \brief Compile-time regression of a pass found by PassProfiler::compare
+/// \ingroup ov_pass_cpp_api
+struct PassProfileRegression {
+    std::string manager;
+    std::string name;
+    std::chrono::nanoseconds baseline_time{0};
+    std::chrono::nanoseconds time{0};
+};
+
+/// \brief PassProfiler collects the statistics of all the transformation passes run by any pass::Manager
+/// while the profiler is started, including the MatcherPasses nested in GraphRewrite containers.
+/// It allows to measure the transformations pipeline of a whole compile_model call:
+///
+///     pass::PassProfiler profiler;
+///     profiler.start();
+///     auto compiled_model = core.compile_model(model, "CPU");
+///     profiler.stop();
+///     std::ofstream("profile.json") << pass::PassProfiler::to_json(profiler.get_profiles());
+///
+/// The statistics of the same pass run by the same manager are accumulated, the profiles are ordered
+/// by the first run of the pass, so the counters and the order are reproducible for the same model.
+/// \ingroup ov_pass_cpp_api
+class OPENVINO_API PassProfiler {
+public:
+    PassProfiler();
+    ~PassProfiler();
+
+    PassProfiler(const PassProfiler&) = delete;
+    PassProfiler& operator=(const PassProfiler&) = delete;
+
+    /// \brief Starts collecting the statistics of the passes run in any thread
+    void start();
+
+    /// \brief Stops collecting the statistics, the collected ones are kept
+    void stop();
+
+    /// \brief Drops the collected statistics
+    void clear();
+
+    /// \return The statistics collected so far
+    std::vector<PassProfile> get_profiles() const;
+
+    /// \brief Serializes the profiles to a JSON array
+    static std::string to_json(const std::vector<PassProfile>& profiles);
+
+    /// \brief Reads the profiles serialized by to_json, e.g. a saved baseline
+    static std::vector<PassProfile> from_json(const std::string& json);
+
+    /// \brief Finds the passes which became slower than in the baseline
+    /// \param baseline Profiles of the reference run
+    /// \param profiles Profiles of the checked run
+    /// \param tolerance Allowed relative slowdown, e.g. 0.1 allows a pass to be 10% slower
+    /// \param min_slowdown Absolute slowdown below which a pass isn't reported, filters out the noise of fast passes
+    /// \return Regressions in the order of the checked profiles; passes missing in the baseline are ignored
+    static std::vector<PassProfileRegression> compare(const std::vector<PassProfile>& baseline,
+                                                      const std::vector<PassProfile>& profiles,
+                                                      double tolerance,
+                                                      std::chrono::nanoseconds min_slowdown = std::chrono::milliseconds(1));
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> m_impl;
+};
+
+}  // namespace pass
+}  // namespace ov
@@ -5,6 +5,7 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <regex>
@@ -16,8 +17,12 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_profiler_internal.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -66,6 +71,49 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT_FULL
+
+namespace {
+// Collects the types of the graph nodes which the pattern root can be matched with.
+// Returns false if the root can be matched with a node of any type.
+bool collect_root_types(const std::shared_ptr<ov::Node>& root, std::vector<ov::NodeTypeInfo>& types) {
+    using namespace ov::pass::pattern;
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to get actual root node we need to take it's parent.
+    if (auto any_output = ov::as_type_ptr<op::AnyOutput>(root)) {
+        return collect_root_types(any_output->input_value(0).get_node_shared_ptr(), types);
+    }
+    if (auto wrap_type = ov::as_type_ptr<op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    if (auto optional = ov::as_type_ptr<op::Optional>(root)) {
+        // the optional node is either matched by its types or skipped in favor of its first input
+        const auto optional_types = optional->get_optional_types();
+        types.insert(types.end(), optional_types.begin(), optional_types.end());
+        return optional->get_input_size() == 0 ||
+               collect_root_types(optional->input_value(0).get_node_shared_ptr(), types);
+    }
+    if (ov::as_type_ptr<op::Or>(root)) {
+        for (const auto& input : root->input_values()) {
+            if (!collect_root_types(input.get_node_shared_ptr(), types)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (ov::as_type_ptr<op::Label>(root)) {
+        // the predicate of a label can only narrow the set of the nodes matched by the wrapped values
+        return root->get_input_size() != 0 && collect_root_types(root->input_value(0).get_node_shared_ptr(), types);
+    }
+    if (std::dynamic_pointer_cast<op::Pattern>(root)) {
+        return false;
+    }
+    types.push_back(root->get_type_info());
+    return true;
+}
+}  // namespace
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,52 +149,71 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index the matchers by the types of the nodes their pattern roots can match. The matchers which
+    // roots can match a node of any type are run on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> any_type_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
+        root_types.clear();
+        if (!matcher || !collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            any_type_matchers.push_back(matcher_index);
+            continue;
         }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+        for (const auto& root_type_info : root_types) {
+            auto& matchers = type_to_matcher[root_type_info];
+            // the same matcher may be registered for a type several times, e.g. via different Or branches
+            if (matchers.empty() || matchers.back() != matcher_index) {
+                matchers.push_back(matcher_index);
+            }
         }
+    }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+    // matchers to run for the node types met in the model, resolved once per type
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> resolved_type_to_matcher;
+    auto get_matchers_to_run = [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto resolved = resolved_type_to_matcher.find(type_info);
+        if (resolved != resolved_type_to_matcher.end()) {
+            return resolved->second;
+        }
+        // collect the matchers registered for the type and all its parents and sort them in order of
+        // the registration
+        std::vector<size_t> matcher_passes_to_run = any_type_matchers;
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return resolved_type_to_matcher.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
-    }
+    // statistics of the matchers which are reported to the started PassProfilers
+    struct MatcherStatistics {
+        size_t runs = 0;
+        size_t applied = 0;
+        std::chrono::nanoseconds time{0};
+    };
+    const bool profile = profiling::is_enabled();
+    std::vector<MatcherStatistics> matcher_statistics(profile ? m_matchers.size() : 0);
+    size_t nodes_visited = 0;
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -159,7 +226,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(std::move(node));
+        bool status = false;
+        if (profile) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(std::move(node));
+            auto& statistics = matcher_statistics[matcher_index];
+            statistics.time += std::chrono::steady_clock::now() - start;
+            statistics.runs++;
+            statistics.applied += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(std::move(node));
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -175,9 +252,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -185,6 +259,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         auto node = weak_node.lock();
         if (!node)
             continue;
+        nodes_visited++;
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
@@ -200,47 +275,26 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers_to_run(node->get_type_info())) {
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
+    }
 
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+    if (profile) {
+        const auto& manager = profiling::current_manager();
+        profiling::record(manager, get_name(), std::chrono::nanoseconds(0), 0, 0, nodes_visited);
+        for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
+            const auto& statistics = matcher_statistics[matcher_index];
+            if (statistics.runs != 0) {
+                profiling::record(manager,
+                                  get_name() + "/" + m_matchers[matcher_index]->get_name(),
+                                  statistics.time,
+                                  statistics.runs,
+                                  statistics.applied,
+                                  0);
             }
         }
     }
@@ -21,6 +21,7 @@
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_profiler_internal.hpp"
 #include "perf_counters.hpp"
 
 #ifdef ENABLE_PROFILING_ITT_FULL
@@ -334,6 +335,7 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
 bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "pass::Manager::run_passes");
     Profiler profiler(m_name);
+    ov::pass::profiling::ManagerScope manager_scope(m_name);
 
     bool model_changed = false;
     bool pass_changed_model = false;
@@ -376,14 +378,29 @@ bool ov::pass::Manager::run_pass(const std::shared_ptr<PassBase>& pass,
 
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
 
-    if (auto matcher_pass = ov::as_type_ptr<MatcherPass>(pass)) {
-        // GraphRewrite is a temporary container for MatcherPass to make execution on entire ov::Model
-        return GraphRewrite(matcher_pass).run_on_model(model);
-    } else if (auto model_pass = ov::as_type_ptr<ModelPass>(pass)) {
-        if (ov::as_type_ptr<ov::pass::Validate>(model_pass) && !needs_validate) {
-            return false;
+    const auto run = [&]() -> bool {
+        if (auto matcher_pass = ov::as_type_ptr<MatcherPass>(pass)) {
+            // GraphRewrite is a temporary container for MatcherPass to make execution on entire ov::Model
+            return GraphRewrite(matcher_pass).run_on_model(model);
+        } else if (auto model_pass = ov::as_type_ptr<ModelPass>(pass)) {
+            if (ov::as_type_ptr<ov::pass::Validate>(model_pass) && !needs_validate) {
+                return false;
+            }
+            return model_pass->run_on_model(model);
         }
-        return model_pass->run_on_model(model);
+        return false;
+    };
+
+    if (!ov::pass::profiling::is_enabled()) {
+        return run();
     }
-    return false;
+    const auto start = std::chrono::steady_clock::now();
+    const bool changed = run();
+    ov::pass::profiling::record(m_name,
+                                pass->get_name(),
+                                std::chrono::steady_clock::now() - start,
+                                1,
+                                changed ? 1 : 0,
+                                0);
+    return changed;
 }
@@ -0,0 +1,347 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/pass_profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+#include "pass_profiler_internal.hpp"
+
+namespace ov {
+namespace pass {
+namespace {
+
+class Collector {
+public:
+    void record(const std::string& manager,
+                const std::string& name,
+                std::chrono::nanoseconds time,
+                size_t runs,
+                size_t applied,
+                size_t nodes_visited) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto key = manager + '\n' + name;
+        auto it = m_index.find(key);
+        if (it == m_index.end()) {
+            it = m_index.emplace(std::move(key), m_profiles.size()).first;
+            m_profiles.push_back(PassProfile{manager, name});
+        }
+        auto& profile = m_profiles[it->second];
+        profile.runs += runs;
+        profile.applied += applied;
+        profile.nodes_visited += nodes_visited;
+        profile.time += time;
+    }
+
+    std::vector<PassProfile> get_profiles() const {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_profiles;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_profiles.clear();
+        m_index.clear();
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<PassProfile> m_profiles;
+    std::unordered_map<std::string, size_t> m_index;
+};
+
+// the started profilers; the counter allows to check if profiling is enabled without taking the mutex
+std::atomic<size_t> active_collectors_count{0};
+
+std::mutex& active_collectors_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<Collector*>& active_collectors() {
+    static std::vector<Collector*> collectors;
+    return collectors;
+}
+
+thread_local const std::string* current_manager_name = nullptr;
+
+void append_json_string(std::ostringstream& out, const std::string& value) {
+    out << '"';
+    for (const char c : value) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                out << buf;
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+// Parser of the JSON produced by PassProfiler::to_json: an array of flat objects with string and integer values
+class JsonReader {
+public:
+    explicit JsonReader(const std::string& json) : m_json(json) {}
+
+    std::vector<PassProfile> read() {
+        std::vector<PassProfile> profiles;
+        expect('[');
+        if (!try_consume(']')) {
+            do {
+                profiles.push_back(read_profile());
+            } while (try_consume(','));
+            expect(']');
+        }
+        skip_spaces();
+        OPENVINO_ASSERT(m_pos == m_json.size(), "Unexpected data after the passes profile at position ", m_pos);
+        return profiles;
+    }
+
+private:
+    PassProfile read_profile() {
+        PassProfile profile;
+        expect('{');
+        if (try_consume('}')) {
+            return profile;
+        }
+        do {
+            const auto key = read_string();
+            expect(':');
+            if (key == "manager") {
+                profile.manager = read_string();
+            } else if (key == "name") {
+                profile.name = read_string();
+            } else if (key == "runs") {
+                profile.runs = read_number();
+            } else if (key == "applied") {
+                profile.applied = read_number();
+            } else if (key == "nodes_visited") {
+                profile.nodes_visited = read_number();
+            } else if (key == "time_ns") {
+                profile.time = std::chrono::nanoseconds(read_number());
+            } else {
+                skip_value();
+            }
+        } while (try_consume(','));
+        expect('}');
+        return profile;
+    }
+
+    std::string read_string() {
+        expect('"');
+        std::string value;
+        while (m_pos < m_json.size() && m_json[m_pos] != '"') {
+            char c = m_json[m_pos++];
+            if (c == '\\') {
+                OPENVINO_ASSERT(m_pos < m_json.size(), "Unterminated string in the passes profile");
+                c = m_json[m_pos++];
+                switch (c) {
+                case 'n':
+                    c = '\n';
+                    break;
+                case 't':
+                    c = '\t';
+                    break;
+                case 'u':
+                    OPENVINO_ASSERT(m_pos + 4 <= m_json.size(), "Wrong escape sequence in the passes profile");
+                    c = static_cast<char>(std::stoi(m_json.substr(m_pos, 4), nullptr, 16));
+                    m_pos += 4;
+                    break;
+                default:
+                    break;
+                }
+            }
+            value.push_back(c);
+        }
+        expect('"');
+        return value;
+    }
+
+    size_t read_number() {
+        skip_spaces();
+        const auto start = m_pos;
+        while (m_pos < m_json.size() && std::isdigit(static_cast<unsigned char>(m_json[m_pos]))) {
+            ++m_pos;
+        }
+        OPENVINO_ASSERT(m_pos != start, "Expected a number in the passes profile at position ", start);
+        return static_cast<size_t>(std::stoull(m_json.substr(start, m_pos - start)));
+    }
+
+    void skip_value() {
+        skip_spaces();
+        if (m_pos < m_json.size() && m_json[m_pos] == '"') {
+            read_string();
+            return;
+        }
+        while (m_pos < m_json.size() && m_json[m_pos] != ',' && m_json[m_pos] != '}') {
+            ++m_pos;
+        }
+    }
+
+    void skip_spaces() {
+        while (m_pos < m_json.size() && std::isspace(static_cast<unsigned char>(m_json[m_pos]))) {
+            ++m_pos;
+        }
+    }
+
+    bool try_consume(char c) {
+        skip_spaces();
+        if (m_pos < m_json.size() && m_json[m_pos] == c) {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        OPENVINO_ASSERT(try_consume(c), "Expected '", c, "' in the passes profile at position ", m_pos);
+    }
+
+    const std::string& m_json;
+    size_t m_pos = 0;
+};
+
+}  // namespace
+
+namespace profiling {
+
+bool is_enabled() {
+    return active_collectors_count.load(std::memory_order_relaxed) != 0;
+}
+
+void record(const std::string& manager,
+            const std::string& name,
+            std::chrono::nanoseconds time,
+            size_t runs,
+            size_t applied,
+            size_t nodes_visited) {
+    std::lock_guard<std::mutex> lock{active_collectors_mutex()};
+    for (auto* collector : active_collectors()) {
+        collector->record(manager, name, time, runs, applied, nodes_visited);
+    }
+}
+
+const std::string& current_manager() {
+    static const std::string no_manager;
+    return current_manager_name ? *current_manager_name : no_manager;
+}
+
+ManagerScope::ManagerScope(const std::string& name) : m_previous(current_manager_name) {
+    current_manager_name = &name;
+}
+
+ManagerScope::~ManagerScope() {
+    current_manager_name = m_previous;
+}
+
+}  // namespace profiling
+
+struct PassProfiler::Impl : public Collector {
+    bool m_started = false;
+};
+
+PassProfiler::PassProfiler() : m_impl(std::make_shared<Impl>()) {}
+
+PassProfiler::~PassProfiler() {
+    stop();
+}
+
+void PassProfiler::start() {
+    std::lock_guard<std::mutex> lock{active_collectors_mutex()};
+    if (!m_impl->m_started) {
+        active_collectors().push_back(m_impl.get());
+        active_collectors_count = active_collectors().size();
+        m_impl->m_started = true;
+    }
+}
+
+void PassProfiler::stop() {
+    std::lock_guard<std::mutex> lock{active_collectors_mutex()};
+    if (m_impl->m_started) {
+        auto& collectors = active_collectors();
+        collectors.erase(std::remove(collectors.begin(), collectors.end(), m_impl.get()), collectors.end());
+        active_collectors_count = collectors.size();
+        m_impl->m_started = false;
+    }
+}
+
+void PassProfiler::clear() {
+    m_impl->clear();
+}
+
+std::vector<PassProfile> PassProfiler::get_profiles() const {
+    return m_impl->get_profiles();
+}
+
+std::string PassProfiler::to_json(const std::vector<PassProfile>& profiles) {
+    std::ostringstream out;
+    out << "[";
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        const auto& profile = profiles[i];
+        out << (i == 0 ? "\n" : ",\n") << "  {\"manager\": ";
+        append_json_string(out, profile.manager);
+        out << ", \"name\": ";
+        append_json_string(out, profile.name);
+        out << ", \"runs\": " << profile.runs << ", \"applied\": " << profile.applied
+            << ", \"nodes_visited\": " << profile.nodes_visited << ", \"time_ns\": " << profile.time.count() << "}";
+    }
+    out << (profiles.empty() ? "]" : "\n]") << "\n";
+    return out.str();
+}
+
+std::vector<PassProfile> PassProfiler::from_json(const std::string& json) {
+    return JsonReader(json).read();
+}
+
+std::vector<PassProfileRegression> PassProfiler::compare(const std::vector<PassProfile>& baseline,
+                                                         const std::vector<PassProfile>& profiles,
+                                                         double tolerance,
+                                                         std::chrono::nanoseconds min_slowdown) {
+    OPENVINO_ASSERT(tolerance >= 0, "The tolerance of the passes profile comparison can't be negative");
+    std::unordered_map<std::string, const PassProfile*> baseline_index;
+    for (const auto& profile : baseline) {
+        baseline_index.emplace(profile.manager + '\n' + profile.name, &profile);
+    }
+
+    std::vector<PassProfileRegression> regressions;
+    for (const auto& profile : profiles) {
+        const auto it = baseline_index.find(profile.manager + '\n' + profile.name);
+        if (it == baseline_index.end()) {
+            continue;
+        }
+        const auto baseline_time = it->second->time;
+        const auto allowed_time = static_cast<double>(baseline_time.count()) * (1.0 + tolerance);
+        if (static_cast<double>(profile.time.count()) > allowed_time && profile.time - baseline_time > min_slowdown) {
+            regressions.push_back(PassProfileRegression{profile.manager, profile.name, baseline_time, profile.time});
+        }
+    }
+    return regressions;
+}
+
+}  // namespace pass
+}  // namespace ov
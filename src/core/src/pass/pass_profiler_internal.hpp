@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace ov {
+namespace pass {
+namespace profiling {
+
+/// \brief Returns true if at least one PassProfiler is started
+bool is_enabled();
+
+/// \brief Accumulates the statistics of a pass in all the started profilers
+void record(const std::string& manager,
+            const std::string& name,
+            std::chrono::nanoseconds time,
+            size_t runs,
+            size_t applied,
+            size_t nodes_visited);
+
+/// \brief Returns the name of the pass::Manager which is running passes in the current thread
+const std::string& current_manager();
+
+/// \brief Marks the pass::Manager as the one running passes in the current thread
+class ManagerScope {
+public:
+    explicit ManagerScope(const std::string& name);
+    ~ManagerScope();
+
+    ManagerScope(const ManagerScope&) = delete;
+    ManagerScope& operator=(const ManagerScope&) = delete;
+
+private:
+    const std::string* m_previous;
+};
+
+}  // namespace profiling
+}  // namespace pass
+}  // namespace ov
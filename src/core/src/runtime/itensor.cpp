@@ -4,12 +4,17 @@
 
 #include "openvino/runtime/itensor.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <numeric>
 
 #include "compare.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/memory_util.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape_util.hpp"
+#include "openvino/reference/convert.hpp"
 #include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -29,6 +34,42 @@ Strides default_byte_strides(const Shape& shape, const element::Type& et) {
     }
     return strides;
 }
+
+// The copy is split between the threads only when each thread copies at least this amount of bytes,
+// otherwise waking up the threads costs more than the copy itself
+constexpr size_t parallel_copy_bytes_per_thread = 256 * 1024;
+
+using ConvertFunction = void (*)(const uint8_t* src, uint8_t* dst, size_t count);
+
+template <class TI, class TO>
+void convert_elements(const uint8_t* src, uint8_t* dst, size_t count) {
+    reference::convert(reinterpret_cast<const TI*>(src), reinterpret_cast<TO*>(dst), count);
+}
+
+// Returns the conversion used by the copy between the tensors of different element types,
+// nullptr if the conversion isn't supported
+ConvertFunction get_convert_function(const element::Type& src_type, const element::Type& dst_type) {
+    using element::bf16;
+    using element::f16;
+    using element::f32;
+    using element::u8;
+    if (src_type == f32 && dst_type == f16) {
+        return convert_elements<float, float16>;
+    } else if (src_type == f16 && dst_type == f32) {
+        return convert_elements<float16, float>;
+    } else if (src_type == f32 && dst_type == bf16) {
+        return convert_elements<float, bfloat16>;
+    } else if (src_type == bf16 && dst_type == f32) {
+        return convert_elements<bfloat16, float>;
+    } else if (src_type == bf16 && dst_type == f16) {
+        return convert_elements<bfloat16, float16>;
+    } else if (src_type == u8 && dst_type == f32) {
+        return convert_elements<uint8_t, float>;
+    } else if (src_type == u8 && dst_type == f16) {
+        return convert_elements<uint8_t, float16>;
+    }
+    return nullptr;
+}
 }  // namespace
 
 ITensor::~ITensor() = default;
@@ -66,17 +107,18 @@ bool ITensor::is_continuous() const {
 }
 
 void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
-    const auto& is_scalar = [](const ov::Shape& shape) {
-        return shape.empty() || (shape.size() == 1 && shape[0] == 1);
-    };
     OPENVINO_ASSERT(dst, "Destination tensor was not initialized.");
     OPENVINO_ASSERT(!dynamic_cast<const ov::IRemoteTensor*>(this),
                     "Default copy to doesn't support copy from remote tensor.");
-    OPENVINO_ASSERT(dst->get_element_type() == get_element_type(),
+
+    const auto& src_type = get_element_type();
+    const auto& dst_type = dst->get_element_type();
+    const auto convert = src_type == dst_type ? nullptr : get_convert_function(src_type, dst_type);
+    OPENVINO_ASSERT(src_type == dst_type || (convert && !std::dynamic_pointer_cast<ov::IRemoteTensor>(dst)),
                     "Tensor element types are not equal. (src: ",
-                    get_element_type(),
+                    src_type,
                     " != dst: ",
-                    dst->get_element_type(),
+                    dst_type,
                     ")");
 
     const auto& shape = get_shape();
@@ -91,102 +133,91 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
 
     auto* src_data = static_cast<const uint8_t*>(data());
     auto* dst_data = static_cast<uint8_t*>(dst->data());
-    ov::Strides src_strides{get_byte_size()};
-    ov::Strides dst_strides{dst->get_byte_size()};
-    ov::Shape cur_pos{0};
-    ov::Shape max_pos{1};
-
-    if (get_element_type().bitwidth() < 8 || (get_strides() == dst->get_strides() && is_continuous()) ||
-        (is_scalar(shape) && is_scalar(dst->get_shape()))) {
+    if (get_size() == 0) {
+        return;
+    }
+    if (src_type.bitwidth() < 8) {
         // OpenVINO doesn't support strides for LP types
-        // or both tensors have default strides
-        // Strides and positions already initialized
-    } else {
-        // Tensors have default strides
-        const auto& type = get_element_type();
-        const auto shape_rank = shape.size();
-        const auto default_strides = default_byte_strides(shape, type);
-
-        src_strides = get_strides();
-        dst_strides = dst->get_strides();
-
-        ov::Strides src_str, dst_str;
-
-        // Calculate src and dst shapes
-        bool found_step = false;
-        for (size_t inverted_idx = shape_rank - 1; inverted_idx < shape_rank; --inverted_idx) {
-            if (!found_step) {
-                if (default_strides[inverted_idx] == src_strides[inverted_idx] &&
-                    src_strides[inverted_idx] == dst_strides[inverted_idx]) {
-                    continue;
-                } else {
-                    found_step = true;
-                    size_t strides_size = inverted_idx + 1;
-                    // Set right size
-                    src_str.resize(strides_size + 1);
-                    dst_str.resize(strides_size + 1);
-                    max_pos.resize(strides_size + 1);
-                    cur_pos.resize(strides_size + 1);
-                    // In case of default continuous strides we can copy several elements
-                    // In other case only one element
-                    size_t dim = 1;
-                    size_t strides = type.size();
-
-                    if (strides_size < default_strides.size()) {
-                        strides = default_strides[strides_size];
-                        dim = shape[strides_size];
-                    }
-                    src_str[strides_size] = strides;
-                    dst_str[strides_size] = strides;
-                    max_pos[strides_size] = dim;
-                    cur_pos[strides_size] = 0;
-                }
-            }
-            src_str[inverted_idx] = src_strides[inverted_idx];
-            dst_str[inverted_idx] = dst_strides[inverted_idx];
-            max_pos[inverted_idx] = shape[inverted_idx];
-            cur_pos[inverted_idx] = 0;
+        std::memcpy(dst_data, src_data, get_byte_size());
+        return;
+    }
+
+    const auto& src_strides = get_strides();
+    const auto& dst_strides = dst->get_strides();
+    const auto src_default_strides = default_byte_strides(shape, src_type);
+    const auto dst_default_strides = default_byte_strides(shape, dst_type);
+
+    // The innermost dimensions which are dense in both tensors are copied as one block of elements,
+    // the dimensions of size 1 don't break the block as their strides are never used
+    size_t block_size = 1;
+    size_t outer_rank = shape.size();
+    for (; outer_rank > 0; --outer_rank) {
+        const auto dim = outer_rank - 1;
+        if (shape[dim] != 1 &&
+            (src_strides[dim] != src_default_strides[dim] || dst_strides[dim] != dst_default_strides[dim])) {
+            break;
         }
-        src_strides = std::move(src_str);
-        dst_strides = std::move(dst_str);
+        block_size *= shape[dim];
     }
 
-    const auto update_index = [](const ov::Shape& pos, const ov::Strides& strides) {
-        return std::inner_product(pos.begin(), pos.end(), strides.begin(), static_cast<size_t>(0));
+    const auto src_element_size = src_type.size();
+    const auto dst_element_size = dst_type.size();
+    const auto copy_elements = [&](const uint8_t* src, uint8_t* dst, size_t count) {
+        if (convert) {
+            convert(src, dst, count);
+        } else if (src_type == element::string) {
+            // in case string tensors, it needs to copy of new values for std::string objects
+            // memcpy is not suitable
+            std::copy_n(reinterpret_cast<const std::string*>(src), count, reinterpret_cast<std::string*>(dst));
+        } else {
+            std::memcpy(dst, src, count * src_element_size);
+        }
     };
 
-    using copy_function_def = std::function<void(const uint8_t*, uint8_t*, size_t)>;
-    copy_function_def memcpy_based_copy = [](const uint8_t* src_data, uint8_t* dst_data, size_t bytes_size) {
-        memcpy(dst_data, src_data, bytes_size);
-    };
-    copy_function_def strings_copy = [](const uint8_t* src_data, uint8_t* dst_data, size_t bytes_size) {
-        // in case string tensors, it needs to copy of new values for std::string objects
-        // memcpy is not suitable
-        auto dst_string = reinterpret_cast<std::string*>(dst_data);
-        auto src_string = reinterpret_cast<const std::string*>(src_data);
-        size_t num_elements_stride = bytes_size / element::string.size();
-        std::copy_n(src_string, num_elements_stride, dst_string);
-    };
-    copy_function_def copy_function = (get_element_type() == element::string) ? strings_copy : memcpy_based_copy;
-
-    bool finish = false;
-    for (size_t dst_idx = 0, src_idx = 0; !finish;) {
-        copy_function(src_data + src_idx, dst_data + dst_idx, src_strides[src_strides.size() - 1]);
-
-        // update indexes
-        for (size_t i = 0; i < cur_pos.size(); i++) {
-            size_t inverted_idx = cur_pos.size() - i - 1;
-            cur_pos[inverted_idx]++;
-            if (cur_pos[inverted_idx] != max_pos[inverted_idx]) {
-                break;
+    // Copies the elements [begin, end) in the order of the dense layout of the shape
+    const auto copy_range = [&](size_t begin, size_t end) {
+        auto block = begin / block_size;
+        auto in_block = begin % block_size;
+        ov::Shape pos(outer_rank, 0);
+        for (size_t dim = outer_rank; dim-- > 0;) {
+            pos[dim] = block % shape[dim];
+            block /= shape[dim];
+        }
+        auto src_offset = std::inner_product(pos.begin(), pos.end(), src_strides.begin(), size_t{0});
+        auto dst_offset = std::inner_product(pos.begin(), pos.end(), dst_strides.begin(), size_t{0});
+
+        while (begin < end) {
+            const auto count = std::min(block_size - in_block, end - begin);
+            copy_elements(src_data + src_offset + in_block * src_element_size,
+                          dst_data + dst_offset + in_block * dst_element_size,
+                          count);
+            begin += count;
+            in_block = 0;
+            for (size_t dim = outer_rank; dim-- > 0;) {
+                src_offset += src_strides[dim];
+                dst_offset += dst_strides[dim];
+                if (++pos[dim] != shape[dim]) {
+                    break;
+                }
+                src_offset -= shape[dim] * src_strides[dim];
+                dst_offset -= shape[dim] * dst_strides[dim];
+                pos[dim] = 0;
             }
-            if (inverted_idx)
-                cur_pos[inverted_idx] = 0;
-            else
-                finish = true;
         }
-        src_idx = update_index(cur_pos, src_strides);
-        dst_idx = update_index(cur_pos, dst_strides);
+    };
+
+    const auto size = get_size();
+    const auto copied_bytes = size * std::max(src_element_size, dst_element_size);
+    const auto threads_num =
+        static_cast<int>(std::min<size_t>(parallel_get_max_threads(), copied_bytes / parallel_copy_bytes_per_thread));
+    if (threads_num <= 1) {
+        copy_range(0, size);
+    } else {
+        parallel_nt(threads_num, [&](const int ithr, const int nthr) {
+            size_t begin = 0, end = 0;
+            splitter(size, nthr, ithr, begin, end);
+            copy_range(begin, end);
+        });
     }
 }
 }  // namespace ov
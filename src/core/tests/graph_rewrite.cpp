@@ -10,12 +10,16 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/op.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/op/relu.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/op/tanh.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/pass/pass_profiler.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -444,3 +448,54 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     OV_ASSERT_NO_THROW(m.run_passes(f));
 }
+
+class CountReluOrTanh : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("CountReluOrTanh");
+    CountReluOrTanh() {
+        auto relu_or_tanh = std::make_shared<pattern::op::Or>(
+            OutputVector{pattern::wrap_type<ov::op::v0::Relu>(), pattern::wrap_type<ov::op::v0::Tanh>()});
+        auto label = std::make_shared<pattern::op::Label>(relu_or_tanh->output(0), nullptr, NodeVector{relu_or_tanh});
+        ov::matcher_pass_callback callback = [](pattern::Matcher&) {
+            return false;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(label, "CountReluOrTanh"), callback);
+    }
+};
+
+class CountAny : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("CountAny");
+    CountAny() {
+        ov::matcher_pass_callback callback = [](pattern::Matcher&) {
+            return false;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(pattern::any_input(), "CountAny"), callback);
+    }
+};
+
+TEST(GraphRewriteTest, MatchersAreDispatchedByRootTypes) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(data);
+    auto tanh = std::make_shared<ov::op::v0::Tanh>(relu);
+    auto divide = std::make_shared<ov::op::v1::Divide>(tanh, ov::op::v0::Constant::create(element::f32, Shape{1}, {2}));
+    auto model = std::make_shared<Model>(OutputVector{divide}, ParameterVector{data});
+
+    auto rewrite = std::make_shared<GraphRewrite>();
+    rewrite->add_matcher<CountReluOrTanh>();
+    // the matcher which root can match any node doesn't disable the dispatch of the other matchers
+    rewrite->add_matcher<CountAny>();
+
+    PassProfiler profiler;
+    profiler.start();
+    rewrite->run_on_model(model);
+    profiler.stop();
+
+    std::map<std::string, size_t> runs;
+    for (const auto& profile : profiler.get_profiles()) {
+        runs[profile.name] = profile.runs;
+    }
+    EXPECT_EQ(runs[rewrite->get_name() + "/CountReluOrTanh"], 2);
+    // Parameter, Relu, Tanh, Constant, Divide and Result
+    EXPECT_EQ(runs[rewrite->get_name() + "/CountAny"], 6);
+}
@@ -5,6 +5,7 @@
 #include <gmock/gmock.h>
 
 #include <cstdint>
+#include <numeric>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/except.hpp"
@@ -1245,4 +1246,70 @@ INSTANTIATE_TEST_SUITE_P(copy_tests_strings,
                                                               }
                                            )));
 // clang-format on
+
+TEST_F(OVTensorTest, copyLargeRoiTensor) {
+    // large enough to be copied by several threads, the copy blocks are split between the threads
+    ov::Tensor src(ov::element::f32, ov::Shape{4, 64, 64, 130});
+    auto* src_data = src.data<float>();
+    std::iota(src_data, src_data + src.get_size(), 0.f);
+    const ov::Tensor roi(src, {1, 0, 3, 1}, {4, 64, 61, 129});
+    ov::Tensor dst(ov::element::f32, roi.get_shape());
+
+    roi.copy_to(dst);
+
+    const auto& shape = roi.get_shape();
+    const auto* dst_data = dst.data<float>();
+    for (size_t n = 0; n < shape[0]; ++n) {
+        for (size_t c = 0; c < shape[1]; ++c) {
+            for (size_t h = 0; h < shape[2]; ++h) {
+                for (size_t w = 0; w < shape[3]; ++w) {
+                    const auto expected = static_cast<float>((((n + 1) * 64 + c) * 64 + h + 3) * 130 + w + 1);
+                    ASSERT_EQ(expected, dst_data[((n * shape[1] + c) * shape[2] + h) * shape[3] + w]);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(OVTensorTest, copyToWithConversion) {
+    ov::Tensor src(ov::element::f32, ov::Shape{2, 3, 8});
+    auto* src_data = src.data<float>();
+    for (size_t i = 0; i < src.get_size(); ++i) {
+        src_data[i] = static_cast<float>(i) * 0.5f;
+    }
+
+    ov::Tensor f16_tensor(ov::element::f16, ov::Shape{2, 3, 8});
+    OV_ASSERT_NO_THROW(src.copy_to(f16_tensor));
+    ov::Tensor bf16_tensor(ov::element::bf16, ov::Shape{2, 3, 8});
+    OV_ASSERT_NO_THROW(src.copy_to(bf16_tensor));
+    for (size_t i = 0; i < src.get_size(); ++i) {
+        EXPECT_EQ(src_data[i], static_cast<float>(f16_tensor.data<ov::float16>()[i]));
+        EXPECT_EQ(src_data[i], static_cast<float>(bf16_tensor.data<ov::bfloat16>()[i]));
+    }
+
+    // strided source and the conversion back to f32
+    const ov::Tensor f16_roi(f16_tensor, {0, 1, 2}, {2, 3, 6});
+    ov::Tensor f32_tensor(ov::element::f32, ov::Shape{2, 2, 4});
+    OV_ASSERT_NO_THROW(f16_roi.copy_to(f32_tensor));
+    for (size_t n = 0; n < 2; ++n) {
+        for (size_t c = 0; c < 2; ++c) {
+            for (size_t w = 0; w < 4; ++w) {
+                EXPECT_EQ(src_data[(n * 3 + c + 1) * 8 + w + 2], f32_tensor.data<float>()[(n * 2 + c) * 4 + w]);
+            }
+        }
+    }
+
+    ov::Tensor u8_tensor(ov::element::u8, ov::Shape{4});
+    std::iota(u8_tensor.data<uint8_t>(), u8_tensor.data<uint8_t>() + 4, uint8_t{250});
+    ov::Tensor u8_to_f32(ov::element::f32, ov::Shape{4});
+    OV_ASSERT_NO_THROW(u8_tensor.copy_to(u8_to_f32));
+    EXPECT_THAT(std::vector<float>(u8_to_f32.data<float>(), u8_to_f32.data<float>() + 4),
+                ::testing::ElementsAre(250.f, 251.f, 252.f, 253.f));
+}
+
+TEST_F(OVTensorTest, copyToWithUnsupportedConversionThrows) {
+    const ov::Tensor src(ov::element::i64, ov::Shape{2, 3});
+    ov::Tensor dst(ov::element::i8, ov::Shape{2, 3});
+    OV_EXPECT_THROW(src.copy_to(dst), ov::Exception, ::testing::HasSubstr("Tensor element types are not equal"));
+}
 }  // namespace ov::test
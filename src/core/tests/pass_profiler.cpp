@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/pass_profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov;
+using namespace ov::pass;
+
+namespace {
+
+class CountRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("CountRelu");
+    CountRelu() {
+        auto relu = pattern::wrap_type<ov::op::v0::Relu>();
+        ov::matcher_pass_callback callback = [](pattern::Matcher&) {
+            return false;
+        };
+        register_matcher(std::make_shared<pattern::Matcher>(relu, "CountRelu"), callback);
+    }
+};
+
+class CountReluRewrite : public ov::pass::GraphRewrite {
+public:
+    OPENVINO_GRAPH_REWRITE_RTTI("CountReluRewrite");
+    CountReluRewrite() {
+        add_matcher<CountRelu>();
+    }
+};
+
+std::shared_ptr<ov::Model> make_relu_chain() {
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{1, 3});
+    auto relu_0 = std::make_shared<ov::op::v0::Relu>(data);
+    auto relu_1 = std::make_shared<ov::op::v0::Relu>(relu_0);
+    return std::make_shared<ov::Model>(OutputVector{relu_1}, ParameterVector{data});
+}
+
+}  // namespace
+
+TEST(PassProfilerTest, CollectsManagerAndMatcherStatistics) {
+    auto model = make_relu_chain();
+    pass::Manager manager("TestManager");
+    manager.set_per_pass_validation(false);
+    auto rewrite = manager.register_pass<CountReluRewrite>();
+
+    PassProfiler profiler;
+    profiler.start();
+    manager.run_passes(model);
+    manager.run_passes(model);
+    profiler.stop();
+    // the passes run after stop() are not collected
+    manager.run_passes(model);
+
+    const auto profiles = profiler.get_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_EQ(profiles[0].manager, "TestManager");
+    EXPECT_EQ(profiles[0].name, rewrite->get_name());
+    EXPECT_EQ(profiles[0].runs, 2);
+    EXPECT_EQ(profiles[0].applied, 0);
+    // Parameter, 2 Relu and Result are visited in each run
+    EXPECT_EQ(profiles[0].nodes_visited, 8);
+
+    EXPECT_EQ(profiles[1].manager, "TestManager");
+    EXPECT_EQ(profiles[1].name, rewrite->get_name() + "/CountRelu");
+    EXPECT_EQ(profiles[1].runs, 4);
+    EXPECT_EQ(profiles[1].applied, 0);
+    EXPECT_LE(profiles[1].time, profiles[0].time);
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.get_profiles().empty());
+}
+
+TEST(PassProfilerTest, JsonRoundTrip) {
+    std::vector<PassProfile> profiles(2);
+    profiles[0] = {"Manager \"A\"", "Pass\\1", 3, 1, 10, std::chrono::nanoseconds(12345)};
+    profiles[1] = {"Manager B", "Rewrite/Matcher", 7, 0, 0, std::chrono::nanoseconds(0)};
+
+    const auto restored = PassProfiler::from_json(PassProfiler::to_json(profiles));
+    ASSERT_EQ(restored.size(), profiles.size());
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        EXPECT_EQ(restored[i].manager, profiles[i].manager);
+        EXPECT_EQ(restored[i].name, profiles[i].name);
+        EXPECT_EQ(restored[i].runs, profiles[i].runs);
+        EXPECT_EQ(restored[i].applied, profiles[i].applied);
+        EXPECT_EQ(restored[i].nodes_visited, profiles[i].nodes_visited);
+        EXPECT_EQ(restored[i].time, profiles[i].time);
+    }
+    EXPECT_TRUE(PassProfiler::from_json(PassProfiler::to_json({})).empty());
+    EXPECT_THROW(PassProfiler::from_json("[{\"runs\": }]"), ov::Exception);
+}
+
+TEST(PassProfilerTest, CompareWithBaseline) {
+    using std::chrono::milliseconds;
+    const std::vector<PassProfile> baseline = {{"M", "Fast", 1, 0, 0, milliseconds(1)},
+                                               {"M", "Slow", 1, 0, 0, milliseconds(100)},
+                                               {"M", "Stable", 1, 0, 0, milliseconds(100)}};
+    const std::vector<PassProfile> profiles = {{"M", "New", 1, 0, 0, milliseconds(50)},
+                                               {"M", "Fast", 1, 0, 0, milliseconds(2)},
+                                               {"M", "Slow", 1, 0, 0, milliseconds(150)},
+                                               {"M", "Stable", 1, 0, 0, milliseconds(105)}};
+
+    // "Fast" is twice slower but below the absolute threshold, "Stable" is within the tolerance
+    const auto regressions = PassProfiler::compare(baseline, profiles, 0.1, milliseconds(5));
+    ASSERT_EQ(regressions.size(), 1);
+    EXPECT_EQ(regressions[0].name, "Slow");
+    EXPECT_EQ(regressions[0].baseline_time, milliseconds(100));
+    EXPECT_EQ(regressions[0].time, milliseconds(150));
+}
@@ -429,16 +429,18 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const {
     // Last boolean flag in `variants` (if presented) is reserved for FE configuration
     size_t extra_variants_num = variants.size() > 0 && variants[variants.size() - 1].is<bool>() ? 1 : 0;
+    // The .pdiparams file is mapped to the memory by default, the constants share it instead of copying the weights
+    bool mmap_enabled = extra_variants_num == 1 ? variants.back().as<bool>() : true;
     if (variants.size() == 1 + extra_variants_num) {
         // The case when folder with __model__ and weight files is provided or .pdmodel file
         if (variants[0].is<std::string>()) {
             std::string m_path = variants[0].as<std::string>();
-            return std::make_shared<InputModel>(m_path, m_telemetry);
+            return std::make_shared<InputModel>(m_path, m_telemetry, mmap_enabled);
         }
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
         else if (variants[0].is<std::wstring>()) {
             std::wstring m_path = variants[0].as<std::wstring>();
-            return std::make_shared<InputModel>(m_path, m_telemetry);
+            return std::make_shared<InputModel>(m_path, m_telemetry, mmap_enabled);
         }
 #endif
         // The case with only model stream provided and no weights. This means model has
@@ -4,6 +4,8 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #if defined(__MINGW32__) || defined(__MINGW64__)
 #    include <filesystem>
@@ -16,8 +18,10 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -32,7 +36,8 @@ public:
     template <typename T>
     InputModelImpl(const std::basic_string<T>& path,
                    const InputModel& input_model,
-                   const std::shared_ptr<TelemetryExtension>& telemetry);
+                   const std::shared_ptr<TelemetryExtension>& telemetry,
+                   bool mmap_enabled);
     InputModelImpl(const std::vector<std::istream*>& streams,
                    const InputModel& input_model,
                    const std::shared_ptr<TelemetryExtension>& telemetry);
@@ -64,6 +69,7 @@ private:
     template <typename T>
     void load_consts(const std::basic_string<T>& folder_with_weights);
     void load_consts(std::istream* weight_stream);
+    void load_consts(const std::shared_ptr<ov::MappedMemory>& weights);
     void create_temp_consts();
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
@@ -225,6 +231,20 @@ std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path
     return model_file;
 }
 #endif
+
+template <typename T>
+std::basic_string<T> get_params_path(const std::basic_string<T>& model_path) {
+    std::string ext = ".pdmodel";
+    return model_path.substr(0, model_path.size() - ext.size()) + ".pdiparams";
+}
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+template <>
+std::basic_string<wchar_t> get_params_path(const std::basic_string<wchar_t>& model_path) {
+    std::wstring ext = L".pdmodel";
+    return model_path.substr(0, model_path.size() - ext.size()) + L".pdiparams";
+}
+#endif
 }  // namespace
 
 std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::get_op_places(const int32_t blck_idx) const {
@@ -382,18 +402,80 @@ void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
     }
 }
 
+// load_consts with mapped memory is compatible with new PaddlePaddle API, the constants share the mapped *.pdiparams
+// file instead of copying the weights, the records have the same layout as in the stream.
+void InputModel::InputModelImpl::load_consts(const std::shared_ptr<ov::MappedMemory>& weights) {
+    const char* data = weights->data();
+    const size_t size = weights->size();
+    size_t offset = 0;
+    for (const auto& item : m_var_places) {
+        const auto& var_desc = item.second->get_desc();
+        const auto& name = item.first;
+        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
+            continue;
+
+        // var_desc.persistable() is used to mark node const value or not.
+        if (!var_desc.persistable())
+            continue;
+
+        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
+        FRONT_END_GENERAL_CHECK(offset < size, "PaddlePaddle *.pdiparams format weight file doesn't exist!");
+
+        const size_t header_size = 16;
+        int32_t desc_size = 0;
+        FRONT_END_GENERAL_CHECK(size - offset >= header_size + sizeof(desc_size),
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+        offset += header_size;
+        std::memcpy(&desc_size, data + offset, sizeof(desc_size));
+        offset += sizeof(desc_size);
+        FRONT_END_GENERAL_CHECK(desc_size >= 0 && size - offset >= static_cast<size_t>(desc_size),
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+
+        ::paddle::framework::proto::VarType_TensorDesc tensor_desc;
+        tensor_desc.ParseFromArray(data + offset, desc_size);
+        offset += desc_size;
+        Shape shape(tensor_desc.dims().cbegin(), tensor_desc.dims().cend());
+        const auto& type = get_ov_type(tensor_desc.data_type());
+        const auto& data_length = shape_size(shape) * type.size();
+        FRONT_END_GENERAL_CHECK(size - offset >= data_length,
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+
+        std::shared_ptr<opset7::Constant> const_node;
+        if (reinterpret_cast<uintptr_t>(data + offset) % std::max<size_t>(type.size(), 1) != 0) {
+            // the records follow variable size descriptors, misaligned data is copied
+            const_node = opset7::Constant::create(type, shape, data + offset);
+        } else {
+            auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                const_cast<char*>(data + offset),
+                data_length,
+                weights);
+            const_node = std::make_shared<opset7::Constant>(type, shape, buffer);
+        }
+        offset += data_length;
+        const_node->set_friendly_name(name);
+        m_tensor_values[name] = const_node;
+    }
+}
+
 /*
     1. path: is a directory, compatible with old PaddlePaddle API.
              read __model__ as model stream.
              read the separate weights in the directory.
     2. path: is a pdmodel file, compatible with new PaddlePaddle API.
              read *.pdmodel as model stream.
-             read *.pdiparam as weight stream.
+             read *.pdiparam as weight stream or map it to the memory if mmap is enabled.
 */
 template <typename T>
 InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
                                            const InputModel& input_model,
-                                           const std::shared_ptr<TelemetryExtension>& telemetry)
+                                           const std::shared_ptr<TelemetryExtension>& telemetry,
+                                           bool mmap_enabled)
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model),
       m_telemetry(telemetry) {
@@ -415,7 +497,12 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     load_places();
     if (is_pdmodel(path)) {
-        load_consts(&weights_stream);
+        if (mmap_enabled && weights_stream.is_open()) {
+            weights_stream.close();
+            load_consts(ov::load_mmap_object(get_params_path(path)));
+        } else {
+            load_consts(&weights_stream);
+        }
     } else {
         load_consts(path);
     }
@@ -577,12 +664,16 @@ void InputModel::InputModelImpl::set_tensor_value(Place::Ptr place, const void*
     m_tensor_values[name] = constant;
 }
 
-InputModel::InputModel(const std::string& path, const std::shared_ptr<TelemetryExtension>& telemetry)
-    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry)} {}
+InputModel::InputModel(const std::string& path,
+                       const std::shared_ptr<TelemetryExtension>& telemetry,
+                       bool mmap_enabled)
+    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry, mmap_enabled)} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-InputModel::InputModel(const std::wstring& path, const std::shared_ptr<TelemetryExtension>& telemetry)
-    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry)} {}
+InputModel::InputModel(const std::wstring& path,
+                       const std::shared_ptr<TelemetryExtension>& telemetry,
+                       bool mmap_enabled)
+    : _impl{std::make_shared<InputModelImpl>(path, *this, telemetry, mmap_enabled)} {}
 #endif
 
 InputModel::InputModel(const std::vector<std::istream*>& streams, const std::shared_ptr<TelemetryExtension>& telemetry)
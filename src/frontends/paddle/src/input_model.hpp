@@ -16,9 +16,13 @@ class TensorPlace;
 
 class InputModel : public ov::frontend::InputModel {
 public:
-    explicit InputModel(const std::string& path, const std::shared_ptr<TelemetryExtension>& telemetry = {});
+    explicit InputModel(const std::string& path,
+                        const std::shared_ptr<TelemetryExtension>& telemetry = {},
+                        bool mmap_enabled = false);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    explicit InputModel(const std::wstring& path, const std::shared_ptr<TelemetryExtension>& telemetry = {});
+    explicit InputModel(const std::wstring& path,
+                        const std::shared_ptr<TelemetryExtension>& telemetry = {},
+                        bool mmap_enabled = false);
 #endif
     explicit InputModel(const std::vector<std::istream*>& streams,
                         const std::shared_ptr<TelemetryExtension>& telemetry = {});
@@ -9,9 +9,11 @@
 #include <set>
 #include <string>
 
+#include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/unicode_utils.hpp"
 #include "frontend/shared/include/utils.hpp"
+#include "openvino/frontend/manager.hpp"
 #include "openvino/openvino.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset8.hpp"
@@ -163,3 +165,23 @@ TEST(Paddle_Reader_Tests, ImportBasicModelToCoreWstring) {
     ASSERT_TRUE(res.valid) << res.message;
 }
 #endif
+
+TEST(Paddle_Reader_Tests, MappedAndReadWeightsAreEqual) {
+    ov::frontend::FrontEndManager fem;
+    const auto front_end = fem.load_by_framework("paddle");
+    ASSERT_NE(front_end, nullptr);
+    // the records of several weights follow the descriptors of variable size, so some of them are misaligned
+    for (const auto& model_name : {"conv2d_relu/conv2d_relu", "batch_norm_nchw/batch_norm_nchw"}) {
+        const auto path = FrontEndTestUtils::make_model_path(std::string(TEST_PADDLE_MODELS_DIRNAME) + model_name +
+                                                             std::string(TEST_PADDLE_MODEL_EXT));
+        const auto mapped_model = front_end->convert(front_end->load({path, true}));
+        const auto read_model = front_end->convert(front_end->load({path, false}));
+
+        const auto fc = FunctionsComparator::with_default()
+                            .enable(FunctionsComparator::PRECISIONS)
+                            .enable(FunctionsComparator::NAMES)
+                            .enable(FunctionsComparator::CONST_VALUES);
+        const auto res = fc.compare(mapped_model, read_model);
+        EXPECT_TRUE(res.valid) << model_name << ": " << res.message;
+    }
+}
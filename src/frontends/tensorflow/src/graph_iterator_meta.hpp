@@ -147,6 +147,9 @@ private:
         for (auto var : var_map) {
             m_variables_index->map_variable(var.first, var.second);
         }
+        if (m_variables_index.get() != nullptr) {
+            m_variables_index->prefetch_variables(*m_graph_def);
+        }
 
         initialize_decoders_and_library();
 
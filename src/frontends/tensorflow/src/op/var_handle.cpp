@@ -45,12 +45,27 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
             node,
             static_cast<int64_t>(mapped_memory->size()) >= entry.offset() + entry.size(),
             "[TensorFlow Frontend] Internal error: Variable entry size is out of bounds of mapped memory size.");
+        auto data = mapped_memory->data() + entry.offset();
+        if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+            // misaligned variable data is copied, the element access on it isn't portable
+            return std::make_shared<v0::Constant>(ov_type, shape, data);
+        }
+        return std::make_shared<v0::Constant>(
+            ov_type,
+            shape,
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(data, entry.size(), mapped_memory));
+    }
+
+    // the variable data is prefetched together with the neighbours from the shard file
+    char* data = nullptr;
+    if (auto buffer = var_index->get_prefetched_data(entry.shard_id(), entry.offset(), entry.size(), &data)) {
+        if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+            return std::make_shared<v0::Constant>(ov_type, shape, data);
+        }
         return std::make_shared<v0::Constant>(
             ov_type,
             shape,
-            std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data() + entry.offset(),
-                                                                              entry.size(),
-                                                                              mapped_memory));
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data, entry.size(), buffer));
     } else {
         std::vector<T> var_data;
         var_data.resize(size);
@@ -4,8 +4,12 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
@@ -484,6 +488,131 @@ void VariablesIndex::map_assignvariable(const std::shared_ptr<::tensorflow::Grap
     nodes.clear();
 }
 
+namespace {
+// Variables of a shard which are closer than the gap are read by a single range read
+constexpr int64_t coalescing_gap = 64 * 1024;
+// Maximum number of threads reading the shard files, reading is bound by the storage latency, not by the cores
+constexpr size_t max_io_threads = 16;
+
+struct ShardRange {
+    int64_t begin;
+    int64_t end;
+};
+}  // namespace
+
+void VariablesIndex::prefetch_variables(const ::tensorflow::GraphDef& graph_def) {
+    if (m_mmap_enabled) {
+        return;
+    }
+
+    // Collect data ranges of the variables used by the graph
+    std::map<int32_t, std::vector<ShardRange>> shard_ranges;
+    for (const auto& node : graph_def.node()) {
+        if (node.op() != "VarHandleOp" && node.op() != "VariableV2") {
+            continue;
+        }
+        const char* entry_data = nullptr;
+        size_t entry_size = 0;
+        if (!get_mapped_variable(node.name(), &entry_data, &entry_size) &&
+            !get_variable(node.name(), &entry_data, &entry_size)) {
+            continue;
+        }
+        ::tensorflow::BundleEntryProto entry{};
+        if (!entry.ParseFromArray(entry_data, static_cast<int>(entry_size)) || entry.size() == 0 ||
+            m_data_files.count(entry.shard_id()) == 0) {
+            continue;
+        }
+        shard_ranges[entry.shard_id()].push_back({entry.offset(), entry.offset() + entry.size()});
+    }
+
+    std::vector<std::pair<int32_t, std::vector<ShardRange>>> jobs;
+    for (auto& shard : shard_ranges) {
+        auto& ranges = shard.second;
+        std::sort(ranges.begin(), ranges.end(), [](const ShardRange& a, const ShardRange& b) {
+            return a.begin < b.begin;
+        });
+        std::vector<ShardRange> coalesced{ranges.front()};
+        for (const auto& range : ranges) {
+            if (range.begin <= coalesced.back().end + coalescing_gap) {
+                coalesced.back().end = std::max(coalesced.back().end, range.end);
+            } else {
+                coalesced.push_back(range);
+            }
+        }
+        jobs.emplace_back(shard.first, std::move(coalesced));
+    }
+    if (jobs.empty()) {
+        return;
+    }
+
+    // Each shard is read by a single thread with the shard stream, threads don't share the streams.
+    // A range which cannot be read is skipped, its variables are read from the stream during the translation.
+    const size_t threads_num = std::min(jobs.size(), max_io_threads);
+    std::atomic<size_t> next_job{0};
+    std::vector<std::exception_ptr> errors(threads_num);
+    auto read_shards = [&](size_t thread_id) {
+        try {
+            for (size_t job = next_job++; job < jobs.size(); job = next_job++) {
+                auto& storage = m_data_files.at(jobs[job].first);
+                for (const auto& range : jobs[job].second) {
+                    const auto size = range.end - range.begin;
+                    auto buffer = std::make_shared<ov::AlignedBuffer>(static_cast<size_t>(size));
+                    storage.stream->seekg(range.begin, std::ios::beg);
+                    storage.stream->read(buffer->get_ptr<char>(), size);
+                    if (storage.stream->gcount() != size) {
+                        storage.stream->clear();
+                        continue;
+                    }
+                    storage.ranges[range.begin] = std::move(buffer);
+                }
+            }
+        } catch (...) {
+            errors[thread_id] = std::current_exception();
+            next_job = jobs.size();
+        }
+    };
+
+    // Plain threads instead of ov::parallel_for: the frontend doesn't link the threading library of the runtime,
+    // and the reads block on the storage, so they must not occupy the workers of the compute arena.
+    std::vector<std::thread> threads;
+    threads.reserve(threads_num - 1);
+    for (size_t thread_id = 1; thread_id < threads_num; ++thread_id) {
+        threads.emplace_back(read_shards, thread_id);
+    }
+    read_shards(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+std::shared_ptr<ov::AlignedBuffer> VariablesIndex::get_prefetched_data(const int32_t shard_id,
+                                                                       const int64_t offset,
+                                                                       const int64_t size,
+                                                                       char** data) const {
+    auto shard = m_data_files.find(shard_id);
+    if (shard == m_data_files.end()) {
+        return nullptr;
+    }
+    const auto& ranges = shard->second.ranges;
+    auto range = ranges.upper_bound(offset);
+    if (range == ranges.begin()) {
+        return nullptr;
+    }
+    --range;
+    if (offset + size > range->first + static_cast<int64_t>(range->second->size())) {
+        return nullptr;
+    }
+    if (data != nullptr) {
+        *data = range->second->get_ptr<char>() + (offset - range->first);
+    }
+    return range->second;
+}
+
 }  // namespace tensorflow
 }  // namespace frontend
 }  // namespace ov
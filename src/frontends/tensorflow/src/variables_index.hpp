@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "ov_tensorflow/saved_model.pb.h"
@@ -23,6 +24,8 @@ struct VIBlock;
 struct VariableStorage {
     std::shared_ptr<std::ifstream> stream;
     std::shared_ptr<ov::MappedMemory> mmap;
+    // Prefetched ranges of the shard file, key is an offset of the range in the file
+    std::map<int64_t, std::shared_ptr<ov::AlignedBuffer>> ranges;
 };
 
 // Stores information about variables index
@@ -122,6 +125,23 @@ public:
         return result != m_data_files.end() ? result->second.mmap : nullptr;
     }
 
+    /// \brief Reads data of the variables used by the graph from the shard files ahead of the translation.
+    /// Shards are read concurrently by a bounded number of threads, adjacent variables of a shard are coalesced
+    /// into a single range read. Does nothing if mmap is enabled, variables are built over the mapped shards then.
+    /// \param graph_def GraphDef object with VarHandleOp and VariableV2 nodes which variables are read
+    void prefetch_variables(const ::tensorflow::GraphDef& graph_def);
+
+    /// \brief Returns a prefetched range of the shard file which contains the requested data
+    /// \param shard_id Shard of the data
+    /// \param offset Offset of the data in the shard file
+    /// \param size Size of the data
+    /// \param data Pointer on a pointer where data pointer in the range will be returned
+    /// \returns Range buffer or nullptr if the data isn't prefetched (data will be untouched)
+    std::shared_ptr<ov::AlignedBuffer> get_prefetched_data(const int32_t shard_id,
+                                                           const int64_t offset,
+                                                           const int64_t size,
+                                                           char** data) const;
+
     /// \brief Adds variable mapping to the variables map
     /// \param var_name Variable full name (from .index file)
     /// \param map_name Mapped name
@@ -168,6 +168,13 @@ TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMMAPCompare) {
     { model_ref = convert_model("saved_model_variables", nullptr, {}, {}, {}, {}, {}, true); }
 }
 
+TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelShardedVariablesMMAPCompare) {
+    // without mmap the variables of the shards are prefetched by the range reads
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    { model = convert_model("saved_model_sharded_variables", nullptr, {}, {}, {}, {}, {}, true); }
+    { model_ref = convert_model("saved_model_sharded_variables"); }
+}
+
 TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelWithNumericalNames) {
     comparator.enable(FunctionsComparator::CmpValues::TENSOR_NAMES);
     // The test aims to check that model with only numerical names for operation
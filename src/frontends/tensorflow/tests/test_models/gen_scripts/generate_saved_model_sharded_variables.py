@@ -0,0 +1,36 @@
+# Copyright (C) 2018-2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import numpy as np
+import tensorflow as tf
+
+# The variables are placed on two logical CPU devices, the checkpoint keeps a shard per device
+cpus = tf.config.list_physical_devices('CPU')
+tf.config.set_logical_device_configuration(cpus[0], [tf.config.LogicalDeviceConfiguration(),
+                                                     tf.config.LogicalDeviceConfiguration()])
+
+
+class ShardedVariables(tf.Module):
+    def __init__(self):
+        super(ShardedVariables, self).__init__()
+        rng = np.random.default_rng(42)
+        self.vars = []
+        for idx in range(6):
+            with tf.device('/cpu:{}'.format(idx % 2)):
+                # a large variable separates the neighbours by more than the range read gap
+                shape = [256, 128] if idx == 2 else [4, 128]
+                self.vars.append(tf.Variable(rng.standard_normal(shape).astype(np.float32)))
+
+    @tf.function(input_signature=[tf.TensorSpec([4, 128], tf.float32)])
+    def __call__(self, x):
+        res = x
+        for var in self.vars:
+            res = res + tf.reduce_sum(var, axis=0, keepdims=True)
+        return {'test_output_name': res}
+
+
+module = ShardedVariables()
+tf.saved_model.save(module, os.path.join(sys.argv[1], "saved_model_sharded_variables"))
@@ -7,24 +7,38 @@
 #include <map>
 
 #include "decoder_flatbuffer.h"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 using namespace ov::frontend::tensorflow_lite;
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
-    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path)) {}
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled)
+    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path), mmap_enabled) {}
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled) {
+    if (mmap_enabled) {
+        auto mapped_memory = ov::load_mmap_object(path);
+        m_data = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped_memory->data(),
+                                                                                      mapped_memory->size(),
+                                                                                      mapped_memory);
+    } else {
+        std::ifstream model_file(path, std::ios::binary | std::ios::in);
+        FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
+        model_file.seekg(0, std::ios::end);
+        const auto file_size = static_cast<size_t>(model_file.tellg());
+        model_file.seekg(0, std::ios::beg);
+        m_data = std::make_shared<ov::AlignedBuffer>(file_size);
+        model_file.read(m_data->get_ptr<char>(), file_size);
+        FRONT_END_GENERAL_CHECK(static_cast<size_t>(model_file.gcount()) == file_size,
+                                "Model file can't be read: ",
+                                path);
+    }
 
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(m_data->get_ptr());
     auto sub_graphs = m_model->subgraphs();
     m_subgraphs = {sub_graphs->begin(), sub_graphs->end()};
     m_graph = m_subgraphs[0];
@@ -46,6 +60,7 @@ std::shared_ptr<GraphIterator> GraphIteratorFlatBuffer::get_subgraph(size_t idx)
     FRONT_END_GENERAL_CHECK(m_subgraphs.size() > idx, "There is no subgraph with idx ", idx);
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
+    iterator->m_data = m_data;
     iterator->m_model = m_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
@@ -13,6 +13,7 @@
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/tensorflow_lite/decoder.hpp"
 #include "openvino/frontend/tensorflow_lite/graph_iterator.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "schema_generated.h"
@@ -38,7 +39,8 @@ std::basic_string<wchar_t> get_model_extension<wchar_t>();
 
 class GraphIteratorFlatBuffer : public GraphIterator {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    // the content of the model file, mapped or read, the constants of the model are views into it
+    std::shared_ptr<ov::AlignedBuffer> m_data;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -46,10 +48,10 @@ class GraphIteratorFlatBuffer : public GraphIterator {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::string& path);
+    explicit GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled = false);
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    explicit GraphIteratorFlatBuffer(const std::wstring& path);
+    explicit GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled = false);
 #endif
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
@@ -92,6 +94,11 @@ public:
         }
     }
 
+    /// Returns the content of the model file which the constants of the model may refer to
+    const std::shared_ptr<ov::AlignedBuffer>& get_model_data() const {
+        return m_data;
+    }
+
     /// Set iterator to the start position
     void reset() override {
         node_index = 0;
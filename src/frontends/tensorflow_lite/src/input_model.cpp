@@ -4,11 +4,15 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <queue>
 
+#include "graph_iterator_flatbuffer.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
@@ -95,6 +99,8 @@ public:
 private:
     void load_model();
     void clean_up();
+    std::shared_ptr<ov::op::v0::Constant> create_constant(const std::shared_ptr<TensorLitePlace>& place,
+                                                          const void* data) const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
     std::map<std::string, std::shared_ptr<OpPlace>> m_op_places_map;
@@ -145,9 +151,7 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_constant(place, data);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -218,6 +222,31 @@ void InputModel::InputModelTFLiteImpl::load_model() {
     }
 }
 
+// The constant is a view into the model file content unless its data is produced by the frontend, e.g. densified
+std::shared_ptr<ov::op::v0::Constant> InputModel::InputModelTFLiteImpl::create_constant(
+    const std::shared_ptr<TensorLitePlace>& place,
+    const void* data) const {
+    const auto& type = place->get_element_type();
+    const auto shape = place->get_partial_shape().to_shape();
+    const auto flatbuffer_iterator = std::dynamic_pointer_cast<GraphIteratorFlatBuffer>(m_graph_iterator);
+    if (flatbuffer_iterator && flatbuffer_iterator->get_model_data() && type != ov::element::string) {
+        const auto& model_data = flatbuffer_iterator->get_model_data();
+        const auto* model_begin = model_data->get_ptr<uint8_t>();
+        const auto* model_end = model_begin + model_data->size();
+        auto* ptr = static_cast<uint8_t*>(const_cast<void*>(data));
+        const auto byte_size = ov::util::get_memory_size(type, shape_size(shape));
+        // misaligned data is copied, the element access on it isn't portable
+        if (ptr >= model_begin && ptr + byte_size <= model_end &&
+            reinterpret_cast<uintptr_t>(ptr) % std::max<size_t>(type.size(), 1) == 0) {
+            return std::make_shared<ov::op::v0::Constant>(
+                type,
+                shape,
+                std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(ptr, byte_size, model_data));
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
+
 InputModel::InputModelTFLiteImpl::InputModelTFLiteImpl(const GraphIterator::Ptr& graph_iterator,
                                                        const ov::frontend::InputModel& input_model)
     : m_graph_iterator(graph_iterator),
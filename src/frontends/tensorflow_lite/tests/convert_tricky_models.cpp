@@ -3,6 +3,7 @@
 //
 
 #include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "common_test_utils/test_control.hpp"
@@ -28,3 +29,17 @@ OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_densify) {
     test_case.add_expected_output<float>(Shape{1, 2, 2, 4}, {2, 1, 0, 0, 0, 3, 1, 0, 0, 2, 0, 0, 2, 0, 1, 0});
     test_case.run();
 }
+
+OPENVINO_TEST(TensorFlowLiteTrickyModels, tflite_mmap_and_read_models_are_equal) {
+    for (const auto& model_path : {"2in_2out/2in_2out.tflite", "densify.tflite"}) {
+        const auto mapped_model = convert_model(model_path);
+        const auto read_model = convert_model(model_path, nullptr, true);
+
+        const auto fc = FunctionsComparator::with_default()
+                            .enable(FunctionsComparator::PRECISIONS)
+                            .enable(FunctionsComparator::NAMES)
+                            .enable(FunctionsComparator::CONST_VALUES);
+        const auto res = fc.compare(mapped_model, read_model);
+        EXPECT_TRUE(res.valid) << model_path << ": " << res.message;
+    }
+}
@@ -46,7 +46,9 @@ static FrontEnd::Ptr get_tflite_frontend(bool default_front_end = true) {
     return front_end;
 }
 
-shared_ptr<Model> convert_model(const string& model_path, const ov::frontend::ConversionExtensionBase::Ptr& conv_ext) {
+shared_ptr<Model> convert_model(const string& model_path,
+                                const ov::frontend::ConversionExtensionBase::Ptr& conv_ext,
+                                bool disable_mmap) {
     auto front_end = get_tflite_frontend(conv_ext == nullptr);
 
     if (conv_ext) {
@@ -54,7 +56,7 @@ shared_ptr<Model> convert_model(const string& model_path, const ov::frontend::Co
     }
 
     auto full_path = FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) + model_path);
-    InputModel::Ptr input_model = front_end->load(full_path);
+    InputModel::Ptr input_model = disable_mmap ? front_end->load({full_path, false}) : front_end->load(full_path);
     if (!input_model) {
         throw "Input Model is not loaded";
     }
@@ -19,7 +19,8 @@ extern const std::string TF_LITE_FE;
 
 // A wrapper to create TensorFlow Lite Frontend and configure the conversion pipeline
 std::shared_ptr<ov::Model> convert_model(const std::string& model_path,
-                                         const ov::frontend::ConversionExtensionBase::Ptr& conv_ext = nullptr);
+                                         const ov::frontend::ConversionExtensionBase::Ptr& conv_ext = nullptr,
+                                         bool disable_mmap = false);
 }  // namespace tests
 }  // namespace tensorflow_lite
 }  // namespace frontend
@@ -23,7 +23,7 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single priority queue.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -47,6 +47,8 @@ public:
 
     void execute(Task task) override;
 
+    void run_prioritized(Task task, int priority) override;
+
     int get_stream_id() override;
 
     int get_streams_num() override;
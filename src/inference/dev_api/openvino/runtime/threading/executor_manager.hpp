@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
@@ -79,6 +82,28 @@ public:
      * @param task task to be performed
      */
     virtual void execute_task_by_streams_executor(ov::hint::SchedulingCoreType core_type, ov::threading::Task task) = 0;
+
+    /**
+     * @brief Registers a consumer of the host-wide CPU cores budget.
+     * The number of the cores is shared between the registered consumers: the consumers with higher priority are
+     * served first and preempt the cores of the lower priority ones, the consumers with the same priority share the
+     * cores proportionally to their weights. Every consumer is granted at least one core, which is reserved before the
+     * rest of the budget is shared, so the grants exceed the cores only if there are more consumers than cores.
+     * The budget only grants the number of the cores, the consumers size their threads by it, no cores are pinned.
+     * The budget is rebalanced each time a consumer is registered or released, the consumers are notified after
+     * the rebalancing without holding the budget lock.
+     * @param priority priority of the consumer, higher value is served first
+     * @param weight relative weight of the consumer among the consumers with the same priority
+     * @param max_cores maximum number of cores the consumer is able to use
+     * @param on_change callback which is called with the number of cores granted to the consumer each time it
+     * changes, including the registration, where it is called by the registering thread before the return.
+     * It is never called once the registration handle is destroyed. It must not release its own registration.
+     * @return registration handle, the cores are returned to the budget when it is destroyed
+     */
+    virtual std::shared_ptr<void> register_cores_consumer(int priority,
+                                                          float weight,
+                                                          int max_cores,
+                                                          std::function<void(int)> on_change) = 0;
 };
 
 OPENVINO_RUNTIME_API std::shared_ptr<ExecutorManager> executor_manager();
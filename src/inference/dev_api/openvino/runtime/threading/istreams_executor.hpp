@@ -289,6 +289,15 @@ public:
      * @param task A task to start
      */
     virtual void execute(Task task) = 0;
+
+    /**
+     * @brief Execute ov::Task inside task executor context with the given priority.
+     *        Tasks with higher priority are dequeued first, tasks with the same priority in the submission order.
+     *        run() submits tasks with the default priority 0. The default implementation ignores the priority.
+     * @param task A task to start
+     * @param priority A priority of the task
+     */
+    virtual void run_prioritized(Task task, int priority);
 };
 
 static std::mutex _streams_executor_mutex;
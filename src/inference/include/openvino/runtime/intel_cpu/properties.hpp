@@ -117,5 +117,39 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines the priority of the infer requests created by a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The inferences of the requests with higher priority are dequeued first by the streams executor of the compiled
+ * model, the inferences with the same priority are executed in the submission order. The property can be changed on
+ * the compiled model, the value is applied to the infer requests created afterwards. It is MEDIUM by default.
+ *
+ * @code
+ * compiled_model.set_property(ov::intel_cpu::infer_request_priority(ov::hint::Priority::HIGH));
+ * auto interactive_request = compiled_model.create_infer_request();
+ * @endcode
+ */
+static constexpr Property<ov::hint::Priority> infer_request_priority{"CPU_INFER_REQUEST_PRIORITY"};
+
+/**
+ * @brief This property enables the runtime trace of the infer requests created by a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The value is the path prefix of the trace files, the tracing is disabled when it's empty (default). A traced request
+ * records the start and the end of its inferences and of every node executed by them, with the thread and the stream
+ * the node is executed by, the node type and implementation, the shapes of the inputs and outputs and the size of the
+ * memory read and written by the node. The trace is written to <prefix>_<n>.json in the Chrome trace event format,
+ * which is opened by chrome://tracing and Perfetto UI, when the request is destroyed. The property can be changed on
+ * the compiled model, the value is applied to the infer requests created afterwards.
+ *
+ * @code
+ * compiled_model.set_property(ov::intel_cpu::runtime_trace_path("/tmp/cpu_trace"));
+ * auto traced_request = compiled_model.create_infer_request();
+ * compiled_model.set_property(ov::intel_cpu::runtime_trace_path(""));
+ * @endcode
+ */
+static constexpr Property<std::string> runtime_trace_path{"CPU_RUNTIME_TRACE_PATH"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -21,10 +21,21 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/thread_local.hpp"
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
 
 namespace ov {
 namespace threading {
 struct CPUStreamsExecutor::Impl {
+    struct PrioritizedTask {
+        int _priority = 0;
+        uint64_t _order = 0;
+        Task _task;
+        // the "greater" task is executed later: lower priority or submitted later within the same priority
+        bool operator>(const PrioritizedTask& other) const {
+            return _priority != other._priority ? _priority < other._priority : _order > other._order;
+        }
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         struct Observer : public custom::task_scheduler_observer {
@@ -361,6 +372,7 @@ struct CPUStreamsExecutor::Impl {
               },
               this) {
         _exectorMgr = executor_manager();
+        _taskQueue.set_capacity(1);
         auto numaNodes = get_available_numa_nodes();
         int streams_num = _config.get_streams();
         auto processor_ids = _config.get_stream_processor_ids();
@@ -379,19 +391,20 @@ struct CPUStreamsExecutor::Impl {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
+                    PrioritizedTask item;
+                    if (!_taskQueue.try_pop(item)) {
+                        // the mutex is only taken to sleep while the queue is empty
                         std::unique_lock<std::mutex> lock(_mutex);
+                        _sleepingThreads++;
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return _queuedTasks.load() > 0 || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                        _sleepingThreads--;
+                        continue;
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    _queuedTasks--;
+                    if (item._task) {
+                        Execute(item._task, *(_streams.local()));
                     }
                 }
             });
@@ -399,12 +412,15 @@ struct CPUStreamsExecutor::Impl {
         _streams.set_thread_ids_map(_threads);
     }
 
-    void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+    void Enqueue(Task task, int priority) {
+        _taskQueue.try_push(PrioritizedTask{priority, _taskOrder++, std::move(task)});
+        // both counters are sequentially consistent, so either the sleeping thread observes the new task,
+        // or the producer observes the sleeping thread and wakes it up
+        _queuedTasks++;
+        if (_sleepingThreads.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -474,7 +490,10 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    ThreadSafeBoundedPriorityQueue<PrioritizedTask> _taskQueue;
+    std::atomic<uint64_t> _taskOrder{0};
+    std::atomic_int _queuedTasks{0};
+    std::atomic_int _sleepingThreads{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -547,10 +566,14 @@ void CPUStreamsExecutor::execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run_prioritized(std::move(task), 0);
+}
+
+void CPUStreamsExecutor::run_prioritized(Task task, int priority) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
@@ -6,6 +6,7 @@
 
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
 #    if (TBB_INTERFACE_VERSION < 12000)
@@ -15,10 +16,16 @@
 #    endif
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace ov {
 namespace threading {
@@ -35,9 +42,44 @@ public:
     void set_property(const ov::AnyMap& properties) override;
     ov::Any get_property(const std::string& name) const override;
     void execute_task_by_streams_executor(ov::hint::SchedulingCoreType core_type, ov::threading::Task task) override;
+    std::shared_ptr<void> register_cores_consumer(int priority,
+                                                  float weight,
+                                                  int max_cores,
+                                                  std::function<void(int)> on_change) override;
 
 private:
+    // delivers the grants to a consumer without holding coresMutex
+    struct CoresNotifier {
+        std::function<void(int)> on_change;
+        // held while the consumer is notified, so it isn't notified once released
+        std::mutex mutex;
+        // the cores granted by the latest rebalancing
+        std::atomic<int> granted{0};
+        int notified = 0;
+        bool released = false;
+    };
+
+    struct CoresConsumer {
+        int priority = 0;
+        float weight = 1.0f;
+        int max_cores = 1;
+        std::shared_ptr<CoresNotifier> notifier;
+    };
+
+    struct CoresConsumerHandle {
+        CoresConsumerHandle(ExecutorManagerImpl* manager, size_t id) : _manager(manager), _id(id) {}
+        ~CoresConsumerHandle() {
+            _manager->release_cores_consumer(_id);
+        }
+        ExecutorManagerImpl* _manager;
+        size_t _id;
+    };
+
     void reset_tbb();
+    void release_cores_consumer(size_t id);
+    // returns the notifiers of the consumers whose grants are changed, in the order they are to be notified
+    std::vector<std::shared_ptr<CoresNotifier>> rebalance_cores();
+    static void notify_cores_consumers(const std::vector<std::shared_ptr<CoresNotifier>>& notifiers);
 
     std::unordered_map<std::string, std::shared_ptr<ov::threading::ITaskExecutor>> executors;
     std::vector<std::pair<ov::threading::IStreamsExecutor::Config, std::shared_ptr<ov::threading::IStreamsExecutor>>>
@@ -47,6 +89,10 @@ private:
     bool tbbTerminateFlag = false;
     mutable std::mutex global_mutex;
     bool tbbThreadsCreated = false;
+    // held while the cores budget is rebalanced, the consumers are notified about the changes after it is released
+    std::mutex coresMutex;
+    std::map<size_t, CoresConsumer> coresConsumers;
+    size_t coresConsumersCounter = 0;
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
 #    if (TBB_INTERFACE_VERSION < 12000)
     std::shared_ptr<tbb::task_scheduler_init> tbbTaskScheduler = nullptr;
@@ -180,6 +226,161 @@ void ExecutorManagerImpl::execute_task_by_streams_executor(ov::hint::SchedulingC
     }
 }
 
+std::shared_ptr<void> ExecutorManagerImpl::register_cores_consumer(int priority,
+                                                                   float weight,
+                                                                   int max_cores,
+                                                                   std::function<void(int)> on_change) {
+    OPENVINO_ASSERT(weight > 0.0f, "Weight of the cores consumer must be positive, got: ", weight);
+    OPENVINO_ASSERT(max_cores > 0, "Cores consumer must be able to use at least one core, got: ", max_cores);
+    auto notifier = std::make_shared<CoresNotifier>();
+    notifier->on_change = std::move(on_change);
+    std::shared_ptr<void> handle;
+    std::vector<std::shared_ptr<CoresNotifier>> notifiers;
+    {
+        std::lock_guard<std::mutex> guard(coresMutex);
+        const auto id = coresConsumersCounter++;
+        coresConsumers[id] = CoresConsumer{priority, weight, max_cores, notifier};
+        handle = std::make_shared<CoresConsumerHandle>(this, id);
+        notifiers = rebalance_cores();
+    }
+    notify_cores_consumers(notifiers);
+    return handle;
+}
+
+void ExecutorManagerImpl::release_cores_consumer(size_t id) {
+    std::shared_ptr<CoresNotifier> released;
+    std::vector<std::shared_ptr<CoresNotifier>> notifiers;
+    {
+        std::lock_guard<std::mutex> guard(coresMutex);
+        auto it = coresConsumers.find(id);
+        if (it == coresConsumers.end()) {
+            return;
+        }
+        released = std::move(it->second.notifier);
+        coresConsumers.erase(it);
+        notifiers = rebalance_cores();
+    }
+    {
+        // waits for the notification in progress
+        std::lock_guard<std::mutex> guard(released->mutex);
+        released->released = true;
+    }
+    notify_cores_consumers(notifiers);
+}
+
+void ExecutorManagerImpl::notify_cores_consumers(const std::vector<std::shared_ptr<CoresNotifier>>& notifiers) {
+    // the consumers being notified by the current thread, their callbacks may register other consumers
+    static thread_local std::vector<const CoresNotifier*> notifying;
+    for (const auto& notifier : notifiers) {
+        if (std::find(notifying.begin(), notifying.end(), notifier.get()) != notifying.end()) {
+            // the latest grant is delivered once the callback in progress returns
+            continue;
+        }
+        std::lock_guard<std::mutex> guard(notifier->mutex);
+        notifying.push_back(notifier.get());
+        // a concurrent rebalancing may have changed the grant again, the consumer gets the latest one
+        while (!notifier->released && notifier->notified != notifier->granted.load()) {
+            notifier->notified = notifier->granted.load();
+            if (notifier->on_change) {
+                try {
+                    notifier->on_change(notifier->notified);
+                } catch (...) {
+                    notifying.pop_back();
+                    throw;
+                }
+            }
+        }
+        notifying.pop_back();
+    }
+}
+
+std::vector<std::shared_ptr<ExecutorManagerImpl::CoresNotifier>> ExecutorManagerImpl::rebalance_cores() {
+    std::vector<CoresConsumer*> consumers;
+    consumers.reserve(coresConsumers.size());
+    for (auto& item : coresConsumers) {
+        consumers.push_back(&item.second);
+    }
+    std::stable_sort(consumers.begin(), consumers.end(), [](const CoresConsumer* lhs, const CoresConsumer* rhs) {
+        return lhs->priority > rhs->priority;
+    });
+
+    // every consumer keeps at least one core to make progress, even if it is preempted, so a core per consumer is
+    // taken out of the budget before the rest is shared. The cores are oversubscribed only if there are more
+    // consumers than cores
+    std::vector<int> extra(consumers.size(), 0);
+    int available = std::max(0, std::max(1, get_number_of_cpu_cores()) - static_cast<int>(consumers.size()));
+    for (size_t group_begin = 0; group_begin < consumers.size();) {
+        size_t group_end = group_begin;
+        while (group_end < consumers.size() && consumers[group_end]->priority == consumers[group_begin]->priority) {
+            group_end++;
+        }
+        // water-filling inside the group: the consumers which can't use their whole weighted share take their
+        // maximum, and the rest of the cores is shared again between the remaining ones
+        std::vector<size_t> pending(group_end - group_begin);
+        std::iota(pending.begin(), pending.end(), group_begin);
+        int budget = available;
+        while (!pending.empty() && budget > 0) {
+            const float total_weight = std::accumulate(pending.begin(), pending.end(), 0.0f, [&](float sum, size_t i) {
+                return sum + consumers[i]->weight;
+            });
+            auto share = [&](size_t i) {
+                return static_cast<float>(budget) * consumers[i]->weight / total_weight;
+            };
+            auto max_extra = [&](size_t i) {
+                return consumers[i]->max_cores - 1;
+            };
+            auto capped = std::partition(pending.begin(), pending.end(), [&](size_t i) {
+                return share(i) < static_cast<float>(max_extra(i));
+            });
+            if (capped != pending.end()) {
+                for (auto it = capped; it != pending.end(); ++it) {
+                    extra[*it] = max_extra(*it);
+                    budget -= extra[*it];
+                }
+                pending.erase(capped, pending.end());
+                continue;
+            }
+            int distributed = 0;
+            for (auto i : pending) {
+                extra[i] = static_cast<int>(share(i));
+                distributed += extra[i];
+            }
+            // the remainder of the integer division goes to the heaviest consumers
+            std::stable_sort(pending.begin(), pending.end(), [&](size_t lhs, size_t rhs) {
+                return consumers[lhs]->weight > consumers[rhs]->weight;
+            });
+            for (size_t i = 0; distributed < budget; i++, distributed++) {
+                extra[pending[i % pending.size()]]++;
+            }
+            budget = 0;
+        }
+        for (size_t i = group_begin; i < group_end; i++) {
+            available -= extra[i];
+        }
+        available = std::max(0, available);
+        group_begin = group_end;
+    }
+
+    // the preempted consumers are notified first, so they release the cores before the others take them
+    std::vector<size_t> order(consumers.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto change = [&](size_t i) {
+        return 1 + extra[i] - consumers[i]->notifier->granted.load();
+    };
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return change(lhs) < change(rhs);
+    });
+    std::vector<std::shared_ptr<CoresNotifier>> notifiers;
+    for (auto i : order) {
+        if (change(i) == 0) {
+            continue;
+        }
+        consumers[i]->notifier->granted = 1 + extra[i];
+        notifiers.push_back(consumers[i]->notifier);
+    }
+    return notifiers;
+}
+
 namespace {
 
 class ExecutorManagerHolder {
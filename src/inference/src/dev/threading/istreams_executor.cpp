@@ -8,6 +8,7 @@
 #include <future>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "openvino/core/parallel.hpp"
@@ -22,6 +23,10 @@ namespace threading {
 
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run_prioritized(Task task, int) {
+    run(std::move(task));
+}
+
 void IStreamsExecutor::Config::set_property(const std::string& key, const ov::Any& value) {
     set_property({{key, value}});
 }
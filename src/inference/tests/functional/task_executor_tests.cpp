@@ -215,6 +215,45 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, higherPriorityTasksAreExecutedFirst) {
+    CPUStreamsExecutor taskExecutor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}};
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    std::vector<int> executed;
+
+    // occupy the only stream, so the next tasks are kept in the queue
+    auto blocker = async(&taskExecutor, [&] {
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isBlocked] {
+            return !isBlocked;
+        });
+    });
+    std::vector<Future> futures;
+    for (int priority : {-1, 0, 1, 0}) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&executed, priority] {
+            executed.push_back(priority);
+        });
+        futures.emplace_back(p->get_future());
+        taskExecutor.run_prioritized(
+            [p] {
+                (*p)();
+            },
+            priority);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+    blocker.wait();
+    for (auto& f : futures) {
+        f.wait();
+    }
+    // the tasks with the same priority keep the submission order
+    ASSERT_EQ((std::vector<int>{1, 0, 0, -1}), executed);
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
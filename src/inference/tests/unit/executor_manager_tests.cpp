@@ -4,6 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 
 using namespace ::testing;
@@ -35,3 +38,99 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, executorMgr->get_executors_number());
 }
+
+TEST(ExecutorManagerTests, coresBudgetIsSharedProportionallyToWeights) {
+    auto executorMgr = ov::threading::executor_manager();
+    const int total = std::max(1, ov::get_number_of_cpu_cores());
+    int light = 0;
+    int heavy = 0;
+
+    auto lightHandle = executorMgr->register_cores_consumer(0, 1.0f, total, [&](int cores) {
+        light = cores;
+    });
+    ASSERT_EQ(total, light);
+
+    auto heavyHandle = executorMgr->register_cores_consumer(0, 3.0f, total, [&](int cores) {
+        heavy = cores;
+    });
+    ASSERT_GE(light, 1);
+    ASSERT_GE(heavy, light);
+    if (total > 1) {
+        ASSERT_EQ(total, light + heavy);
+    }
+
+    // a core per consumer is reserved, so the grants exceed the cores only if there are more consumers than cores
+    int third = 0;
+    auto thirdHandle = executorMgr->register_cores_consumer(0, 1.0f, total, [&](int cores) {
+        third = cores;
+    });
+    ASSERT_EQ(1, std::min({light, heavy, third}));
+    ASSERT_EQ(std::max(total, 3), light + heavy + third);
+    thirdHandle.reset();
+
+    heavyHandle.reset();
+    ASSERT_EQ(total, light);
+}
+
+TEST(ExecutorManagerTests, coresBudgetIsLimitedByMaxCores) {
+    auto executorMgr = ov::threading::executor_manager();
+    const int total = std::max(1, ov::get_number_of_cpu_cores());
+    int limited = 0;
+    int unlimited = 0;
+
+    auto limitedHandle = executorMgr->register_cores_consumer(0, 100.0f, 1, [&](int cores) {
+        limited = cores;
+    });
+    auto unlimitedHandle = executorMgr->register_cores_consumer(0, 1.0f, total, [&](int cores) {
+        unlimited = cores;
+    });
+
+    ASSERT_EQ(1, limited);
+    ASSERT_EQ(std::max(1, total - 1), unlimited);
+}
+
+TEST(ExecutorManagerTests, highPriorityConsumerPreemptsCores) {
+    auto executorMgr = ov::threading::executor_manager();
+    const int total = std::max(1, ov::get_number_of_cpu_cores());
+    int background = 0;
+    int foreground = 0;
+
+    auto backgroundHandle = executorMgr->register_cores_consumer(0, 1.0f, total, [&](int cores) {
+        background = cores;
+    });
+    ASSERT_EQ(total, background);
+
+    auto foregroundHandle = executorMgr->register_cores_consumer(1, 1.0f, total, [&](int cores) {
+        foreground = cores;
+    });
+    // the preempted consumer still keeps a core to make progress, it is taken out of the budget
+    ASSERT_EQ(std::max(1, total - 1), foreground);
+    ASSERT_EQ(1, background);
+
+    foregroundHandle.reset();
+    ASSERT_EQ(total, background);
+}
+
+TEST(ExecutorManagerTests, coresConsumerIsNotifiedWithoutBudgetLock) {
+    auto executorMgr = ov::threading::executor_manager();
+    const int total = std::max(1, ov::get_number_of_cpu_cores());
+    std::shared_ptr<void> nestedHandle;
+    int nested = 0;
+    int outer = 0;
+
+    // the callback may register another consumer, since the budget lock isn't held while it is called
+    auto outerHandle = executorMgr->register_cores_consumer(0, 1.0f, total, [&](int cores) {
+        outer = cores;
+        if (!nestedHandle) {
+            nestedHandle = executorMgr->register_cores_consumer(0, 1.0f, total, [&](int cores) {
+                nested = cores;
+            });
+        }
+    });
+    ASSERT_GE(nested, 1);
+    ASSERT_GE(outer, 1);
+    ASSERT_LE(nested + outer, std::max(total, 2));
+
+    nestedHandle.reset();
+    ASSERT_EQ(total, outer);
+}
@@ -5,12 +5,62 @@
 #include "async_infer_request.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "request_coalescer.h"
+
+namespace {
+
+// submits the tasks to the streams executor queue with the given priority
+class PrioritizedTaskExecutor : public ov::threading::ITaskExecutor {
+public:
+    PrioritizedTaskExecutor(std::shared_ptr<ov::threading::IStreamsExecutor> executor, int priority)
+        : m_executor(std::move(executor)),
+          m_priority(priority) {}
+
+    void run(ov::threading::Task task) override {
+        m_executor->run_prioritized(std::move(task), m_priority);
+    }
+
+private:
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_executor;
+    int m_priority;
+};
+
+// submits the inference task of the request to the coalescer
+class CoalescingTaskExecutor : public ov::threading::ITaskExecutor {
+public:
+    CoalescingTaskExecutor(ov::intel_cpu::RequestCoalescer::Ptr coalescer,
+                           std::shared_ptr<ov::threading::ITaskExecutor> executor,
+                           ov::intel_cpu::SyncInferRequest& request,
+                           bool& inferred)
+        : m_coalescer(std::move(coalescer)),
+          m_executor(std::move(executor)),
+          m_request(request),
+          m_inferred(inferred) {}
+
+    void run(ov::threading::Task task) override {
+        m_coalescer->submit(m_request, m_executor, [&inferred = m_inferred, task = std::move(task)](bool coalesced) {
+            inferred = coalesced;
+            task();
+        });
+    }
+
+private:
+    ov::intel_cpu::RequestCoalescer::Ptr m_coalescer;
+    // the executor of the inference task, e.g. with the priority of the request
+    std::shared_ptr<ov::threading::ITaskExecutor> m_executor;
+    ov::intel_cpu::SyncInferRequest& m_request;
+    bool& m_inferred;
+};
+
+}  // namespace
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const std::shared_ptr<IInferRequest>& request,
@@ -28,6 +78,8 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
         m_infer_func = [this]() {
             check_tensors();
             m_stream_executor->execute([this]() {
+                // the synchronous inference never consumes the inputs staged for an asynchronous one
+                static_cast<SyncInferRequest*>(m_internal_request.get())->drop_staged_inputs();
                 m_internal_request->infer();
             });
         };
@@ -45,6 +97,50 @@ void ov::intel_cpu::AsyncInferRequest::throw_if_canceled() const {
     check_cancelled_state();
 }
 
+void ov::intel_cpu::AsyncInferRequest::set_priority(ov::hint::Priority priority) {
+    if (!m_stream_executor || priority == ov::hint::Priority::MEDIUM) {
+        return;
+    }
+    const auto relative_priority = static_cast<int>(priority) - static_cast<int>(ov::hint::Priority::MEDIUM);
+    m_pipeline = {{std::make_shared<PrioritizedTaskExecutor>(m_stream_executor, relative_priority), [this] {
+                       m_internal_request->infer();
+                   }}};
+}
+
+void ov::intel_cpu::AsyncInferRequest::enable_input_staging(
+    const std::shared_ptr<ov::threading::ITaskExecutor>& staging_executor) {
+    auto* request = static_cast<SyncInferRequest*>(m_internal_request.get());
+    m_pipeline.insert(m_pipeline.begin(), {staging_executor, [request] {
+                                               try {
+                                                   request->stage_inputs();
+                                               } catch (...) {
+                                                   request->drop_staged_inputs();
+                                                   throw;
+                                               }
+                                           }});
+    // the synchronous inference has no staging stage, the inputs staged for an asynchronous inference which hasn't
+    // consumed them are stale. The inference stays on the executor of the synchronous pipeline, i.e. on the stream
+    m_sync_pipeline.back().second = [request] {
+        request->drop_staged_inputs();
+        request->infer();
+    };
+}
+
+void ov::intel_cpu::AsyncInferRequest::enable_request_coalescing(const RequestCoalescer::Ptr& coalescer) {
+    auto& request = *static_cast<SyncInferRequest*>(m_internal_request.get());
+    auto executor = std::make_shared<CoalescingTaskExecutor>(coalescer,
+                                                             m_pipeline.back().first,
+                                                             request,
+                                                             m_inferred_by_coalescer);
+    m_pipeline.back() = {std::move(executor), [this] {
+                             if (m_inferred_by_coalescer) {
+                                 m_inferred_by_coalescer = false;
+                                 return;
+                             }
+                             m_internal_request->infer();
+                         }};
+}
+
 void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
     const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests) {
     m_sub_infer_requests = requests;
@@ -11,8 +11,10 @@
 #include "infer_request.h"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "request_coalescer.h"
 
 namespace ov::intel_cpu {
 
@@ -38,11 +40,33 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Sets the priority of the request inference tasks in the streams executor queue
+     * @param priority the tasks of the requests with a higher priority are executed first
+     */
+    void set_priority(ov::hint::Priority priority);
+
+    /**
+     * @brief Adds the pipeline stage converting the inputs into the request-owned buffers before the inference task
+     * @param staging_executor the executor of the staging stage, it runs while the stream infers the other requests
+     */
+    void enable_input_staging(const std::shared_ptr<ov::threading::ITaskExecutor>& staging_executor);
+
+    /**
+     * @brief Replaces the inference task with the submission to the coalescer, which infers the concurrent requests
+     * together. The tasks are still queued by the executor of the inference task, so the priority of the request is
+     * kept, must be called after set_priority()
+     * @param coalescer the coalescer shared by the requests of the compiled model
+     */
+    void enable_request_coalescing(const RequestCoalescer::Ptr& coalescer);
+
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_sub_infer_requests;
     bool m_has_sub_infers = false;
     std::shared_ptr<IInferRequest> m_internal_request;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor;
     std::function<void()> m_infer_func;
+    // set when the last inference has been performed by the coalescer
+    bool m_inferred_by_coalescer = false;
 };
 
 }  // namespace ov::intel_cpu
@@ -5,17 +5,21 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <exception>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <shared_mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
+#include "elastic_streams_executor.hpp"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
@@ -34,6 +38,8 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "plugin.h"
+#include "request_coalescer.h"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -60,6 +66,8 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 };
 
 CompiledModel::~CompiledModel() {
+    // stop receiving the cores budget updates before anything is released
+    m_cores_budget.reset();
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -107,6 +115,19 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     } else {
         m_callback_executor = m_task_executor;
     }
+    if (m_cfg.asyncInputStaging && m_cfg.numSubStreams == 0) {
+        // a staging stream per inference stream, so the conversions of the concurrent requests aren't serialized
+        m_staging_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+            IStreamsExecutor::Config{"CPUInputStagingExecutor",
+                                     std::max(1, m_cfg.streamExecutorConfig.get_streams()),
+                                     1});
+    }
+    if (!m_cfg.exclusiveAsyncRequests && m_cfg.numSubStreams == 0) {
+        // the streams layout of a regular compiled model can be changed later via set_property
+        m_elastic_executor =
+            std::make_shared<ElasticStreamsExecutor>(std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor));
+        m_task_executor = m_elastic_executor;
+    }
 
     if (m_task_executor) {
         set_task_executor(m_task_executor);
@@ -116,11 +137,14 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     }
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
+    m_coalesce_requests =
+        m_cfg.coalesceRequestsTimeout > 0 && m_cfg.numSubStreams == 0 && RequestCoalescer::isSupported(model);
 
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
+    m_num_graph_slots = streams;
     if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
@@ -171,6 +195,27 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                 std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
         }
     }
+    if (m_elastic_executor && m_cfg.changedModelPriority && !m_cfg.enableNodeSplit) {
+        // the number of threads the model uses standalone is both its weight in the budget and its maximum share
+        const auto max_threads = std::max(1, m_cfg.streamExecutorConfig.get_threads());
+        m_cores_budget = m_plugin->get_executor_manager()->register_cores_consumer(
+            static_cast<int>(m_cfg.modelPriority),
+            static_cast<float>(max_threads),
+            max_threads,
+            [this](int cores) {
+                std::lock_guard<std::mutex> reconfigure_lock{m_reconfigure_mutex};
+                Config cfg;
+                {
+                    std::lock_guard<std::mutex> lock{*m_mutex};
+                    cfg = m_cfg;
+                }
+                if (cores == cfg.streamExecutorConfig.get_threads()) {
+                    return;
+                }
+                cfg.threads = cores;
+                reconfigure_streams(std::move(cfg));
+            });
+    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
@@ -178,20 +223,34 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     int socketId = 0;
 
     size_t graph_idx = 0;
-    if (m_graphs.size() > 1) {
-        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
-        if (nullptr != streamsExecutor) {
-            streamId = streamsExecutor->get_stream_id();
-            socketId = std::max(0, streamsExecutor->get_socket_id());
+    GraphGuard* graph = nullptr;
+    {
+        std::shared_lock<std::shared_mutex> graphs_lock{m_graphs_mutex};
+        if (m_num_graph_slots > 1) {
+            auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+            if (nullptr != streamsExecutor) {
+                streamId = streamsExecutor->get_stream_id();
+                socketId = std::max(0, streamsExecutor->get_socket_id());
+            }
+            graph_idx = streamId % m_num_graph_slots;
         }
-        graph_idx = streamId % m_graphs.size();
+        // references to the deque elements stay valid when it grows
+        graph = &m_graphs[graph_idx];
     }
 
-    auto graphLock = GraphGuard::Lock(m_graphs[graph_idx]);
+    auto graphLock = GraphGuard::Lock(*graph);
+
+    const auto generation = m_graphs_generation.load();
+    if (graphLock._graph._generation != generation) {
+        // the streams layout has been changed, so the graph is recreated for the new number of threads per stream
+        graphLock._graph.reset(generation);
+    }
 
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
-        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+        // the graph context requires the actual streams executor the graph is going to be executed by
+        auto streamsExecutor = m_elastic_executor ? m_elastic_executor->current()
+                                                  : std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
         auto makeGraph = [&] {
             try {
                 GraphContext::Ptr ctx;
@@ -239,6 +298,23 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
                                             get_task_executor(),
                                             get_callback_executor(),
                                             m_optimized_single_stream);
+    ov::hint::Priority priority = ov::hint::Priority::MEDIUM;
+    std::string runtime_trace_path;
+    {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        priority = m_cfg.inferRequestPriority;
+        runtime_trace_path = m_cfg.runtimeTracePath;
+    }
+    async_infer_request->set_priority(priority);
+    if (!runtime_trace_path.empty()) {
+        std::static_pointer_cast<SyncInferRequest>(internal_request)->enable_runtime_trace(runtime_trace_path);
+    }
+    if (m_staging_executor) {
+        async_infer_request->enable_input_staging(m_staging_executor);
+    }
+    if (m_coalesce_requests) {
+        async_infer_request->enable_request_coalescing(get_request_coalescer());
+    }
     if (m_has_sub_compiled_models) {
         std::vector<std::shared_ptr<IAsyncInferRequest>> requests;
         requests.reserve(m_sub_compiled_models.size());
@@ -251,12 +327,99 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
     return async_infer_request;
 }
 
+RequestCoalescer::Ptr CompiledModel::get_request_coalescer() const {
+    std::lock_guard<std::mutex> lock{*m_mutex};
+    auto coalescer = m_request_coalescer.lock();
+    if (coalescer) {
+        return coalescer;
+    }
+    // the coalesced inputs are inferred by the internal requests, which are never coalesced themselves
+    auto compiled_model = std::static_pointer_cast<const CompiledModel>(shared_from_this());
+    auto request_factory = [compiled_model] {
+        return std::make_shared<AsyncInferRequest>(
+            std::static_pointer_cast<SyncInferRequest>(compiled_model->create_sync_infer_request()),
+            compiled_model->get_task_executor(),
+            compiled_model->get_callback_executor(),
+            compiled_model->m_optimized_single_stream);
+    };
+    coalescer = std::make_shared<RequestCoalescer>(std::move(request_factory),
+                                                   std::chrono::microseconds(m_cfg.coalesceRequestsTimeout),
+                                                   m_cfg.coalesceRequestsMaxBatch);
+    m_request_coalescer = coalescer;
+    return coalescer;
+}
+
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
     OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
 
     return get_graph()._graph.dump();
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& property : properties) {
+        if (none_of(property.first,
+                    ov::num_streams.name(),
+                    ov::hint::num_requests.name(),
+                    ov::intel_cpu::infer_request_priority.name(),
+                    ov::intel_cpu::runtime_trace_path.name())) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property ",
+                                           property.first,
+                                           " of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+    const bool change_streams =
+        properties.count(ov::num_streams.name()) != 0 || properties.count(ov::hint::num_requests.name()) != 0;
+    OPENVINO_ASSERT(!change_streams || m_elastic_executor,
+                    "The streams layout of the compiled model ",
+                    m_name,
+                    " can't be changed when exclusive async requests or tensor parallel are enabled");
+
+    // prevents concurrent reconfigurations from overwriting each other's changes
+    std::lock_guard<std::mutex> reconfigure_lock{m_reconfigure_mutex};
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        cfg = m_cfg;
+    }
+    cfg.readProperties(properties, cfg.modelType);
+    if (change_streams) {
+        reconfigure_streams(std::move(cfg));
+    } else {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        m_cfg = std::move(cfg);
+    }
+}
+
+void CompiledModel::reconfigure_streams(Config cfg) {
+    Plugin::get_performance_streams(cfg, m_model);
+
+    const auto& executor_config = cfg.streamExecutorConfig;
+    const auto streams = static_cast<size_t>(std::max(1, executor_config.get_streams()));
+    const bool optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
+
+    // the executor is created once the previous one is drained and has released the cores it reserved
+    auto make_executor = [&] {
+        return m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
+    };
+    m_elastic_executor->reset(make_executor, [&] {
+        // no inference is running at this point, so all the graphs are invalidated at once
+        {
+            std::unique_lock<std::shared_mutex> graphs_lock{m_graphs_mutex};
+            while (m_graphs.size() < streams) {
+                m_graphs.emplace_back();
+            }
+            m_num_graph_slots = streams;
+        }
+        {
+            std::lock_guard<std::mutex> lock{*m_mutex};
+            m_cfg = std::move(cfg);
+        }
+        m_optimized_single_stream = optimized_single_stream;
+        ++m_graphs_generation;
+    });
+}
+
 ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
 
@@ -264,6 +427,45 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::infer_request_priority) {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        return m_cfg.inferRequestPriority;
+    }
+
+    if (name == ov::intel_cpu::runtime_trace_path) {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        return m_cfg.runtimeTracePath;
+    }
+
+    if (any_of(name,
+               ov::num_streams.name(),
+               ov::inference_num_threads.name(),
+               ov::optimal_number_of_infer_requests.name(),
+               ov::hint::num_requests.name())) {
+        // the streams layout may be changed at runtime, so it is taken from the actual config
+        // instead of the config of a graph which may not have been recreated yet
+        Config config;
+        {
+            std::lock_guard<std::mutex> lock{*m_mutex};
+            config = m_cfg;
+        }
+        const auto streams = config.streamExecutorConfig.get_streams();
+        if (name == ov::num_streams) {
+            // ov::num_streams has special negative values (AUTO = -1, NUMA = -2)
+            return decltype(ov::num_streams)::value_type(streams);
+        }
+        if (name == ov::inference_num_threads) {
+            return static_cast<decltype(ov::inference_num_threads)::value_type>(
+                config.streamExecutorConfig.get_threads());
+        }
+        if (name == ov::optimal_number_of_infer_requests) {
+            // ov::optimal_number_of_infer_requests has no negative values
+            return static_cast<decltype(ov::optimal_number_of_infer_requests)::value_type>(streams > 0 ? streams
+                                                                                                       : 1);
+        }
+        return static_cast<decltype(ov::hint::num_requests)::value_type>(config.hintNumRequests);
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -278,30 +480,38 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    // the streams layout can be changed on the compiled model if the streams executor is elastic
+    auto streams_property = [&](const std::string& propertyName) {
+        return ov::PropertyName(propertyName,
+                                m_elastic_executor ? ov::PropertyMutability::RW : ov::PropertyMutability::RO);
+    };
 
     if (name == ov::supported_properties) {
         std::vector<ov::PropertyName> ro_properties{
             RO_property(ov::supported_properties.name()),
             RO_property(ov::model_name.name()),
             RO_property(ov::optimal_number_of_infer_requests.name()),
-            RO_property(ov::num_streams.name()),
+            streams_property(ov::num_streams.name()),
             RO_property(ov::inference_num_threads.name()),
             RO_property(ov::enable_profiling.name()),
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::execution_mode.name()),
-            RO_property(ov::hint::num_requests.name()),
+            streams_property(ov::hint::num_requests.name()),
             RO_property(ov::hint::enable_cpu_pinning.name()),
             RO_property(ov::hint::enable_cpu_reservation.name()),
             RO_property(ov::hint::scheduling_core_type.name()),
             RO_property(ov::hint::model_distribution_policy.name()),
             RO_property(ov::hint::enable_hyper_threading.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::log::level.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
             RO_property(ov::intel_cpu::tbb_partitioner.name()),
+            ov::PropertyName(ov::intel_cpu::infer_request_priority.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::intel_cpu::runtime_trace_path.name(), ov::PropertyMutability::RW),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
             RO_property(ov::hint::kv_cache_precision.name()),
             RO_property(ov::key_cache_precision.name()),
@@ -316,20 +526,6 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         std::string modelName = graph.GetName();
         return decltype(ov::model_name)::value_type(modelName);
     }
-    if (name == ov::optimal_number_of_infer_requests) {
-        const auto streams = config.streamExecutorConfig.get_streams();
-        return static_cast<decltype(ov::optimal_number_of_infer_requests)::value_type>(
-            streams > 0 ? streams : 1);  // ov::optimal_number_of_infer_requests has no negative values
-    }
-    if (name == ov::num_streams) {
-        const auto streams = config.streamExecutorConfig.get_streams();
-        return decltype(ov::num_streams)::value_type(
-            streams);  // ov::num_streams has special negative values (AUTO = -1, NUMA = -2)
-    }
-    if (name == ov::inference_num_threads) {
-        const auto num_threads = config.streamExecutorConfig.get_threads();
-        return static_cast<decltype(ov::inference_num_threads)::value_type>(num_threads);
-    }
     if (name == ov::enable_profiling.name()) {
         const bool perfCount = config.collectPerfCounters;
         return static_cast<decltype(ov::enable_profiling)::value_type>(perfCount);
@@ -366,6 +562,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::hint::execution_mode) {
         return config.executionMode;
     }
+    if (name == ov::hint::model_priority) {
+        return config.modelPriority;
+    }
     if (name == ov::hint::num_requests) {
         return static_cast<decltype(ov::hint::num_requests)::value_type>(config.hintNumRequests);
     }
@@ -418,6 +617,7 @@ void CompiledModel::export_model(std::ostream& modelStream) const {
 }
 
 void CompiledModel::release_memory() {
+    std::shared_lock<std::shared_mutex> graphs_lock{m_graphs_mutex};
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
         std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
@@ -5,15 +5,19 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "config.h"
+#include "elastic_streams_executor.hpp"
 #include "graph.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
@@ -23,6 +27,7 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "request_coalescer.h"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
@@ -34,6 +39,13 @@ public:
 
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // streams layout generation the graph has been created for
+        uint64_t _generation = 0;
+        // drops the graph created for a previous streams layout, must be called under the lock of the guard
+        void reset(uint64_t generation) {
+            Graph::operator=(Graph());
+            _generation = generation;
+        }
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             GraphGuard& _graph;
@@ -56,10 +68,13 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    /**
+     * Only the streams layout can be changed on a compiled model: ov::num_streams and ov::hint::num_requests.
+     * The streams executor is replaced, and graphs are lazily recreated for the new layout reusing the shared weights.
+     * The layout isn't resized by the depth of the requests queue automatically, the application reports its
+     * concurrency by ov::hint::num_requests.
+     */
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
@@ -69,12 +84,16 @@ public:
 
 private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
+    // must be called under m_reconfigure_mutex
+    void reconfigure_streams(Config cfg);
     friend class CompiledModelHolder;
 
     const std::shared_ptr<ov::Model> m_model;
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
+    //! Converts the inputs of the requests in advance, see ov::intel_cpu::async_input_staging
+    std::shared_ptr<ov::threading::ITaskExecutor> m_staging_executor = nullptr;
 
     // Generic synchronization primitive on CompiledModel level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
@@ -86,6 +105,15 @@ private:
     const bool m_loaded_from_cache;
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
+    // protects m_graphs growth and m_num_graph_slots when the streams layout is changed
+    mutable std::shared_mutex m_graphs_mutex;
+    size_t m_num_graph_slots = 1;
+    std::mutex m_reconfigure_mutex;
+    std::atomic<uint64_t> m_graphs_generation = {0};
+    // set when the streams layout can be changed at runtime
+    ElasticStreamsExecutor::Ptr m_elastic_executor = nullptr;
+    // registration in the host-wide cores budget, which resizes the streams layout to the granted share
+    std::shared_ptr<void> m_cores_budget = nullptr;
     mutable SocketsWeights m_socketWeights;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
@@ -94,6 +122,9 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    // the coalescer shared by the infer requests, see ov::intel_cpu::coalesce_requests_timeout
+    RequestCoalescer::Ptr get_request_coalescer() const;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -101,7 +132,10 @@ private:
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
-    bool m_optimized_single_stream = false;
+    std::atomic_bool m_optimized_single_stream = {false};
+    bool m_coalesce_requests = false;
+    // owned by the infer requests, so it's released with the last request
+    mutable std::weak_ptr<RequestCoalescer> m_request_coalescer;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
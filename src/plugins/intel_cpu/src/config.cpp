@@ -179,6 +179,35 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::enable_hyper_threading.name(),
                                ". Expected only true/false.");
             }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = val.as<ov::hint::Priority>();
+                changedModelPriority = true;
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::hint::model_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH.");
+            }
+        } else if (key == ov::intel_cpu::infer_request_priority.name()) {
+            try {
+                inferRequestPriority = val.as<ov::hint::Priority>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::intel_cpu::infer_request_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH.");
+            }
+        } else if (key == ov::intel_cpu::runtime_trace_path.name()) {
+            try {
+                runtimeTracePath = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::runtime_trace_path.name(),
+                               ". Expected a path prefix of the trace files.");
+            }
         } else if (key == ov::intel_cpu::sparse_weights_decompression_rate.name()) {
             float val_f = 0.0F;
             try {
@@ -449,6 +478,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::intel_cpu::enable_tensor_parallel.name(),
                                ". Expected only true/false.");
             }
+        } else if (key == ov::intel_cpu::tensor_parallel_chunk_rows.name()) {
+            try {
+                tensorParallelChunkRows = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::tensor_parallel_chunk_rows.name(),
+                               ". Expected only unsigned integer numbers");
+            }
         } else if (key == ov::cache_encryption_callbacks.name()) {
             try {
                 const auto& encryption_callbacks = val.as<EncryptionCallbacks>();
@@ -475,6 +514,171 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::moe_experts_cache_size.name()) {
+            try {
+                moeExpertsCacheSize = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::moe_experts_cache_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::async_input_staging.name()) {
+            try {
+                asyncInputStaging = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::async_input_staging.name());
+            }
+        } else if (key == ov::intel_cpu::coalesce_requests_timeout.name()) {
+            try {
+                coalesceRequestsTimeout = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::coalesce_requests_timeout.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::coalesce_requests_max_batch.name()) {
+            try {
+                coalesceRequestsMaxBatch = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::coalesce_requests_max_batch.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+            OPENVINO_ASSERT(coalesceRequestsMaxBatch > 0,
+                            "Wrong value 0 for property key ",
+                            ov::intel_cpu::coalesce_requests_max_batch.name(),
+                            ". Expected a positive number");
+        } else if (key == ov::intel_cpu::kv_cache_spill_dir.name()) {
+            kvCacheSpillDir = val.as<std::string>();
+#if !defined(__linux__)
+            // the file backed memory of the KV cache is implemented on Linux only
+            if (!kvCacheSpillDir.empty()) {
+                OPENVINO_THROW("Wrong value ",
+                               kvCacheSpillDir,
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_spill_dir.name(),
+                               ". The KV cache spill files are supported on Linux only");
+            }
+#endif
+        } else if (key == ov::intel_cpu::kv_cache_hot_window.name()) {
+            try {
+                kvCacheHotWindow = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_hot_window.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_window_size.name()) {
+            try {
+                kvCacheWindowSize = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_window_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_sink_tokens.name()) {
+            try {
+                kvCacheSinkTokens = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_sink_tokens.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::weights_compression_mode.name()) {
+            try {
+                const auto mode = val.as<ov::intel_cpu::WeightsCompressionMode>();
+                if (mode == ov::intel_cpu::WeightsCompressionMode::DISABLE) {
+                    weightsCompressionMode = WeightsCompressionMode::Disable;
+                } else if (mode == ov::intel_cpu::WeightsCompressionMode::INT8_SYM) {
+                    weightsCompressionMode = WeightsCompressionMode::Int8Sym;
+                } else if (mode == ov::intel_cpu::WeightsCompressionMode::INT8_ASYM) {
+                    weightsCompressionMode = WeightsCompressionMode::Int8Asym;
+                } else if (mode == ov::intel_cpu::WeightsCompressionMode::INT4_SYM) {
+                    weightsCompressionMode = WeightsCompressionMode::Int4Sym;
+                } else if (mode == ov::intel_cpu::WeightsCompressionMode::INT4_ASYM) {
+                    weightsCompressionMode = WeightsCompressionMode::Int4Asym;
+                } else {
+                    OPENVINO_THROW("invalid value");
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_compression_mode.name(),
+                               ". Expected values: ov::intel_cpu::WeightsCompressionMode::DISABLE/INT8_SYM/INT8_ASYM/"
+                               "INT4_SYM/INT4_ASYM");
+            }
+        } else if (key == ov::intel_cpu::weights_compression_group_size.name()) {
+            try {
+                weightsCompressionGroupSize = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_compression_group_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::fc_structured_sparse_weights.name()) {
+            try {
+                fcStructuredSparseWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::fc_structured_sparse_weights.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::defer_weights_repacking.name()) {
+            try {
+                deferWeightsRepacking = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::defer_weights_repacking.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::weights_numa_placement.name()) {
+            try {
+                const auto placement = val.as<ov::intel_cpu::WeightsNumaPlacement>();
+                if (placement == ov::intel_cpu::WeightsNumaPlacement::STREAM) {
+                    weightsNumaPlacement = WeightsNumaPlacement::Stream;
+                } else if (placement == ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE) {
+                    weightsNumaPlacement = WeightsNumaPlacement::Interleave;
+                } else if (placement == ov::intel_cpu::WeightsNumaPlacement::PARTITION) {
+                    weightsNumaPlacement = WeightsNumaPlacement::Partition;
+                } else {
+                    OPENVINO_THROW("invalid value");
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_numa_placement.name(),
+                               ". Expected values: ov::intel_cpu::WeightsNumaPlacement::STREAM/INTERLEAVE/PARTITION");
+            }
+        } else if (key == ov::intel_cpu::weights_prefetch_size.name()) {
+            try {
+                weightsPrefetchSize = val.as<size_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_prefetch_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
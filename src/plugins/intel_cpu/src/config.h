@@ -42,6 +42,20 @@ struct Config {
         Disable,
     };
 
+    enum class WeightsCompressionMode : uint8_t {
+        Disable,
+        Int8Sym,
+        Int8Asym,
+        Int4Sym,
+        Int4Asym,
+    };
+
+    enum class WeightsNumaPlacement : uint8_t {
+        Stream,
+        Interleave,
+        Partition,
+    };
+
     enum CacheQuantMode : uint8_t {
         AUTO,
         BY_CHANNEL,
@@ -87,6 +101,20 @@ struct Config {
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
+    size_t moeExpertsCacheSize = 0UL;
+    bool asyncInputStaging = false;
+    uint32_t coalesceRequestsTimeout = 0U;
+    size_t coalesceRequestsMaxBatch = 16UL;
+    std::string kvCacheSpillDir;
+    size_t kvCacheHotWindow = 0UL;
+    size_t kvCacheWindowSize = 0UL;
+    size_t kvCacheSinkTokens = 4UL;
+    WeightsCompressionMode weightsCompressionMode = WeightsCompressionMode::Disable;
+    size_t weightsCompressionGroupSize = 128UL;
+    bool fcStructuredSparseWeights = false;
+    bool deferWeightsRepacking = false;
+    WeightsNumaPlacement weightsNumaPlacement = WeightsNumaPlacement::Stream;
+    size_t weightsPrefetchSize = 0UL;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -104,11 +132,18 @@ struct Config {
     ov::intel_cpu::TbbPartitioner tbbPartitioner = ov::intel_cpu::TbbPartitioner::NONE;
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy;
     bool enableTensorParallel = false;
+    size_t tensorParallelChunkRows = 0UL;
     int streamsRankLevel = 1;
     int numSubStreams = 0;
     bool enableNodeSplit = false;
     bool enableHyperThreading = true;
     bool changedHyperThreading = false;
+    // an explicitly set model priority makes the compiled model share the host-wide cores budget
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+    bool changedModelPriority = false;
+    ov::hint::Priority inferRequestPriority = ov::hint::Priority::MEDIUM;
+    // path prefix of the runtime traces of the infer requests, empty if the tracing is disabled
+    std::string runtimeTracePath;
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     LPTransformsMode lpTransformsMode = LPTransformsMode::On;
 #else
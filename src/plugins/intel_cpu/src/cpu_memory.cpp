@@ -38,6 +38,9 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
 #    include <unistd.h>
 
 #    include <cstring> /* strerror(errno) */
@@ -556,11 +559,87 @@ void StaticMemory::StaticMemoryBlock::unregisterMemory(Memory* memPtr) {
     // do nothing
 }
 
+FileBackedMemoryBlock::~FileBackedMemoryBlock() {
 #if defined(__linux__)
-#    define MPOL_DEFAULT   0
-#    define MPOL_BIND      2
-#    define MPOL_MF_STRICT (1 << 0)
-#    define MPOL_MF_MOVE   (1 << 1)
+    if (m_data != nullptr) {
+        munmap(m_data, m_size);
+    }
+    if (m_fd >= 0) {
+        close(m_fd);
+    }
+#endif
+}
+
+void* FileBackedMemoryBlock::getRawPtr() const noexcept {
+    return m_data;
+}
+
+void FileBackedMemoryBlock::setExtBuff(void* ptr, size_t size) {
+    OPENVINO_THROW("[CPU] The file backed memory block can't use an external buffer");
+}
+
+bool FileBackedMemoryBlock::resize(size_t size) {
+    if (m_data != nullptr || size == 0) {
+        OPENVINO_ASSERT(size <= m_size, "[CPU] The file backed memory block can't grow");
+        return false;
+    }
+#if defined(__linux__)
+    m_fd = open(m_directory.c_str(), O_TMPFILE | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (m_fd < 0) {
+        // O_TMPFILE isn't supported by the file system, the file is unlinked right after the creation
+        std::string path = m_directory + "/ov_cpu_memory_XXXXXX";
+        m_fd = mkstemp(path.data());
+        if (m_fd >= 0) {
+            unlink(path.c_str());
+        }
+    }
+    OPENVINO_ASSERT(m_fd >= 0, "[CPU] Can't create a file in ", m_directory, ": ", strerror(errno));
+    OPENVINO_ASSERT(ftruncate(m_fd, static_cast<off_t>(size)) == 0,
+                    "[CPU] Can't allocate ",
+                    size,
+                    " bytes in ",
+                    m_directory,
+                    ": ",
+                    strerror(errno));
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    OPENVINO_ASSERT(data != MAP_FAILED, "[CPU] Can't map ", size, " bytes of a file: ", strerror(errno));
+    m_data = data;
+    m_size = size;
+    return true;
+#else
+    OPENVINO_THROW("[CPU] The file backed memory is supported on Linux only");
+#endif
+}
+
+bool FileBackedMemoryBlock::hasExtBuffer() const noexcept {
+    return false;
+}
+
+void FileBackedMemoryBlock::registerMemory(Memory* memPtr) {
+    // do nothing, the block is never reallocated
+}
+
+void FileBackedMemoryBlock::unregisterMemory(Memory* memPtr) {
+    // do nothing
+}
+
+void FileBackedMemoryBlock::markCold(size_t offset, size_t size) const {
+#if defined(__linux__) && defined(MADV_COLD)
+    const auto pageSize = static_cast<size_t>(getpagesize());
+    const auto begin = offset / pageSize * pageSize;
+    const auto end = std::min(offset + size, m_size) / pageSize * pageSize;
+    if (m_data != nullptr && begin < end) {
+        madvise(static_cast<uint8_t*>(m_data) + begin, end - begin, MADV_COLD);
+    }
+#endif
+}
+
+#if defined(__linux__)
+#    define MPOL_DEFAULT    0
+#    define MPOL_BIND       2
+#    define MPOL_INTERLEAVE 3
+#    define MPOL_MF_STRICT  (1 << 0)
+#    define MPOL_MF_MOVE    (1 << 1)
 #    if !defined(__NR_mbind)
 #        define NR_mbind 237
 #    else
@@ -602,10 +681,37 @@ bool mbind_move(void* data, size_t size, int targetNode) {
     }
     return true;
 }
+
+bool mbind_interleave(void* data, size_t size, const std::vector<int>& numaNodeIDs) {
+    auto pagesize = getpagesize();
+    auto page_count = (size + pagesize - 1) / pagesize;
+    auto* pages = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
+        ((reinterpret_cast<uintptr_t>(data)) & ~(static_cast<uintptr_t>(pagesize - 1))));
+    uint64_t mask = 0;
+    for (const auto numaNodeID : numaNodeIDs) {
+        int realNode = ov::get_org_numa_id(numaNodeID);
+        if (realNode < 0 || realNode >= 64) {
+            return false;
+        }
+        mask |= 1UL << realNode;
+    }
+
+    auto rc =
+        mbind(pages, page_count * pagesize, MPOL_INTERLEAVE, &mask, sizeof(mask) * 8, MPOL_MF_MOVE | MPOL_MF_STRICT);
+    if (rc < 0) {
+        DEBUG_LOG("mbind failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
 #else
 bool mbind_move(void* data, size_t size, int targetNode) {
     return false;
 }
+
+bool mbind_interleave(void* data, size_t size, const std::vector<int>& numaNodeIDs) {
+    return false;
+}
 #endif
 
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
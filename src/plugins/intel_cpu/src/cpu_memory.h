@@ -15,6 +15,7 @@
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
@@ -122,6 +123,41 @@ private:
     std::unique_ptr<IMemoryBlock> m_pMemBlock;
 };
 
+/**
+ * @brief A memory block backed by an unlinked temporary file mapped into the memory. Unlike the anonymous memory, the
+ * pages of the block can be written back to the file and reclaimed by the OS under memory pressure, they are read back
+ * on the first access. The block is allocated by the first resize and can't grow. Supported on Linux only.
+ */
+class FileBackedMemoryBlock : public IMemoryBlockObserver {
+public:
+    explicit FileBackedMemoryBlock(std::string directory) : m_directory(std::move(directory)) {}
+    ~FileBackedMemoryBlock() override;
+
+    FileBackedMemoryBlock(const FileBackedMemoryBlock&) = delete;
+    FileBackedMemoryBlock& operator=(const FileBackedMemoryBlock&) = delete;
+
+    [[nodiscard]] void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    [[nodiscard]] bool hasExtBuffer() const noexcept override;
+    void registerMemory(Memory* memPtr) override;
+    void unregisterMemory(Memory* memPtr) override;
+
+    /**
+     * @brief Marks the pages of the range as cold, so they are the first to be reclaimed. The partially covered pages
+     * at the end of the range stay as is.
+     * @param offset - offset of the range in bytes
+     * @param size - size of the range in bytes
+     */
+    void markCold(size_t offset, size_t size) const;
+
+private:
+    std::string m_directory;
+    int m_fd = -1;
+    void* m_data = nullptr;
+    size_t m_size = 0UL;
+};
+
 using MemoryBlockPtr = std::shared_ptr<IMemoryBlockObserver>;
 using MemoryBlockCPtr = std::shared_ptr<const IMemoryBlockObserver>;
 
@@ -447,6 +483,7 @@ using StringMemoryPtr = std::shared_ptr<StringMemory>;
 bool mbind_move(void* data, size_t size, int targetNode);
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID);
 bool mbind_move(const dnnl::memory& mem, int numaNodeID);
+bool mbind_interleave(void* data, size_t size, const std::vector<int>& numaNodeIDs);
 
 MemoryPtr split_horizontal(const dnnl::engine& eng,
                            const MemoryPtr& src,
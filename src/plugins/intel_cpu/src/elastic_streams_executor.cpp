@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "elastic_streams_executor.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+ElasticStreamsExecutor::ElasticStreamsExecutor(ov::threading::IStreamsExecutor::Ptr executor)
+    : m_executor(std::move(executor)) {
+    OPENVINO_ASSERT(m_executor, "ElasticStreamsExecutor requires a valid streams executor");
+}
+
+ov::threading::IStreamsExecutor::Ptr ElasticStreamsExecutor::current() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_executor;
+}
+
+thread_local const ElasticStreamsExecutor* ElasticStreamsExecutor::t_running = nullptr;
+
+ov::threading::IStreamsExecutor::Ptr ElasticStreamsExecutor::reset(
+    const std::function<ov::threading::IStreamsExecutor::Ptr()>& make_executor,
+    const std::function<void()>& on_switch) {
+    OPENVINO_ASSERT(t_running != this, "The executor can't be replaced by its own task");
+    std::unique_lock<std::shared_mutex> switch_lock{m_switch_mutex};
+    // no task is running, so the cores of the previous executor can be reserved by the new one
+    current()->cpu_reset();
+    auto executor = make_executor();
+    OPENVINO_ASSERT(executor, "ElasticStreamsExecutor requires a valid streams executor");
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        std::swap(m_executor, executor);
+    }
+    if (on_switch) {
+        on_switch();
+    }
+    return executor;
+}
+
+void ElasticStreamsExecutor::run(ov::threading::Task task) {
+    run_prioritized(std::move(task), 0);
+}
+
+void ElasticStreamsExecutor::run_prioritized(ov::threading::Task task, int priority) {
+    auto executor = current();
+    const auto* submitted_to = executor.get();
+    executor->run_prioritized(
+        [this, submitted_to, priority, task = std::move(task)]() mutable {
+            std::shared_lock<std::shared_mutex> switch_lock{m_switch_mutex};
+            if (current().get() != submitted_to) {
+                // the executor has been replaced while the task was waiting in the queue
+                switch_lock.unlock();
+                run_prioritized(std::move(task), priority);
+                return;
+            }
+            run_task(task);
+        },
+        priority);
+}
+
+void ElasticStreamsExecutor::execute(ov::threading::Task task) {
+    if (t_running == this) {
+        // the shared lock isn't acquired recursively, since a waiting switch blocks the new shared owners
+        current()->execute(std::move(task));
+        return;
+    }
+    std::shared_lock<std::shared_mutex> switch_lock{m_switch_mutex};
+    current()->execute([this, task = std::move(task)] {
+        run_task(task);
+    });
+}
+
+void ElasticStreamsExecutor::run_task(const ov::threading::Task& task) const {
+    struct Running {
+        const ElasticStreamsExecutor* previous;
+        ~Running() {
+            t_running = previous;
+        }
+    } running{std::exchange(t_running, this)};
+    task();
+}
+
+int ElasticStreamsExecutor::get_stream_id() {
+    return current()->get_stream_id();
+}
+
+int ElasticStreamsExecutor::get_streams_num() {
+    return current()->get_streams_num();
+}
+
+int ElasticStreamsExecutor::get_numa_node_id() {
+    return current()->get_numa_node_id();
+}
+
+int ElasticStreamsExecutor::get_socket_id() {
+    return current()->get_socket_id();
+}
+
+std::vector<int> ElasticStreamsExecutor::get_rank() {
+    return current()->get_rank();
+}
+
+void ElasticStreamsExecutor::cpu_reset() {
+    current()->cpu_reset();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Streams executor which forwards all the calls to an underlying streams executor
+ * that can be replaced at runtime. It allows a compiled model to change its streams layout
+ * (number of streams and threads per stream) without recreating the infer requests,
+ * which keep the pointer to this executor.
+ */
+class ElasticStreamsExecutor : public ov::threading::IStreamsExecutor {
+public:
+    using Ptr = std::shared_ptr<ElasticStreamsExecutor>;
+
+    explicit ElasticStreamsExecutor(ov::threading::IStreamsExecutor::Ptr executor);
+
+    void run(ov::threading::Task task) override;
+
+    void execute(ov::threading::Task task) override;
+
+    void run_prioritized(ov::threading::Task task, int priority) override;
+
+    int get_stream_id() override;
+
+    int get_streams_num() override;
+
+    int get_numa_node_id() override;
+
+    int get_socket_id() override;
+
+    std::vector<int> get_rank() override;
+
+    void cpu_reset() override;
+
+    /**
+     * @brief Returns the executor which currently runs the tasks
+     */
+    [[nodiscard]] ov::threading::IStreamsExecutor::Ptr current() const;
+
+    /**
+     * @brief Replaces the underlying executor.
+     * Waits for the running tasks to complete and holds off new ones until the switch is done.
+     * The cores reserved by the previous executor are released before the new one is created.
+     * The tasks which are still queued in the previous executor are forwarded to the new one,
+     * so no task is executed by the previous executor after the call.
+     * @param make_executor creates the new streams executor, called when no task is running
+     * @param on_switch callback which is called when no task is running, right after the switch
+     * @return the previous executor
+     */
+    ov::threading::IStreamsExecutor::Ptr reset(
+        const std::function<ov::threading::IStreamsExecutor::Ptr()>& make_executor,
+        const std::function<void()>& on_switch = {});
+
+private:
+    // runs the task marking the current thread as the one holding the switch lock in shared mode
+    void run_task(const ov::threading::Task& task) const;
+
+    // the executor whose task is running on the current thread, the switch lock is held for it
+    static thread_local const ElasticStreamsExecutor* t_running;
+
+    mutable std::mutex m_mutex;
+    // held in shared mode by every running task and in exclusive mode during the executor switch
+    std::shared_mutex m_switch_mutex;
+    ov::threading::IStreamsExecutor::Ptr m_executor;
+};
+
+}  // namespace ov::intel_cpu
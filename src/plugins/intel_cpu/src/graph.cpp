@@ -69,12 +69,15 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "perf_count.h"
 #include "proxy_mem_blk.h"
+#include "runtime_trace.h"
 #include "thread_pool_imp.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/node_dumper.h"
 #include "utils/verbose.h"
 #include "weights_cache.hpp"
+#include "weights_placement.hpp"
+#include "weights_repacker.hpp"
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE || \
      OV_THREAD == OV_THREAD_OMP)
@@ -557,10 +560,14 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    const auto& weightsRepacker = m_context->getWeightsRepacker();
     for (const auto& node : graphNodes) {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
+            // the weights packing requested by the node is deferred until its first execution
+            WeightsRepacker::Scope deferRepacking(weightsRepacker, node.get());
+            WeightsPlacement::Scope placeWeights(m_context->getWeightsPlacement(), node.get());
             node->createPrimitive();
         }
 
@@ -582,6 +589,11 @@ void Graph::CreatePrimitivesAndExecConstants() const {
             ExecuteNodeWithCatch(node);
         }
     }
+
+    if (weightsRepacker) {
+        // pack the deferred weights ahead of the nodes execution
+        weightsRepacker->start();
+    }
 }
 
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc,
@@ -1610,7 +1622,19 @@ inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, i
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    if (const auto& weightsRepacker = m_context->getWeightsRepacker()) {
+        weightsRepacker->wait(node.get());
+    }
+
+    // the weights of the next node are loaded while the node computes
+    if (const auto& weightsPlacement = m_context->getWeightsPlacement()) {
+        weightsPlacement->prefetchNext(node.get());
+    }
+
+    {
+        RuntimeTrace::NodeScope traceNode(request ? request->runtime_trace() : nullptr, *node);
+        node->execute(m_stream, numaId);
+    }
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
@@ -1642,8 +1666,11 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
 static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     int numaNodeId = -1;
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
+    // the weights spread over the NUMA nodes of the stream are kept in place
+    const auto& weightsPlacement = context->getWeightsPlacement();
     if ((context->getCPUStreamExecutor()) &&
-        (context->getConfig().hintPerfMode == ov::hint::PerformanceMode::LATENCY)) {
+        (context->getConfig().hintPerfMode == ov::hint::PerformanceMode::LATENCY) &&
+        !(weightsPlacement && weightsPlacement->spreadsWeights())) {
         numaNodeId = context->getCPUStreamExecutor()->get_numa_node_id();
     }
 #endif
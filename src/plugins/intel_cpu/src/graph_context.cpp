@@ -19,6 +19,8 @@
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
+#include "weights_placement.hpp"
+#include "weights_repacker.hpp"
 
 namespace ov::intel_cpu {
 
@@ -30,6 +32,8 @@ GraphContext::GraphContext(Config config,
                            std::shared_ptr<SubMemoryManager> sub_memory_manager)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
+      m_weightsRepacker(m_config.deferWeightsRepacking ? std::make_shared<WeightsRepacker>() : nullptr),
+      m_weightsPlacement(WeightsPlacement::create(m_config)),
       m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
@@ -17,6 +17,8 @@
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
+#include "weights_placement.hpp"
+#include "weights_repacker.hpp"
 
 namespace ov::intel_cpu {
 
@@ -47,6 +49,14 @@ public:
         return m_weightsCache;
     }
 
+    [[nodiscard]] const WeightsRepacker::Ptr& getWeightsRepacker() const {
+        return m_weightsRepacker;
+    }
+
+    [[nodiscard]] const WeightsPlacement::Ptr& getWeightsPlacement() const {
+        return m_weightsPlacement;
+    }
+
     [[nodiscard]] MultiCachePtr getParamsCache() const {
         return m_rtParamsCache;
     }
@@ -114,6 +124,10 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
+    // deferred repacking of the weights, null if the weights are repacked at the compilation
+    WeightsRepacker::Ptr m_weightsRepacker;
+    // NUMA placement and prefetch of the weights, null if the weights are neither spread nor prefetched
+    WeightsPlacement::Ptr m_weightsPlacement;
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
@@ -5,6 +5,8 @@
 #include "infer_request.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <map>
@@ -32,11 +34,13 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/profiling_info.hpp"
@@ -44,6 +48,7 @@
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "proxy_mem_blk.h"
+#include "runtime_trace.h"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 
@@ -62,6 +67,7 @@ SyncInferRequest::SyncInferRequest(CompiledModelHolder compiled_model)
     for (std::size_t output_index = 0; output_index < outputs.size(); output_index++) {
         m_output_ports_map[output_index] = outputs[output_index];
     }
+    m_input_staging = m_compiled_model.graph().getConfig().asyncInputStaging;
     create_infer_request();
 }
 
@@ -109,14 +115,20 @@ void SyncInferRequest::infer() {
     auto&& graph = graphLock._graph;
     auto message = ov::threading::message_manager();
 
+    // the inputs staged for this inference are consumed even if it is canceled, so they never leak to the next one
+    auto staged_inputs = std::move(m_staged_inputs);
+    m_staged_inputs.clear();
+    const bool inputs_staged = std::exchange(m_inputs_staged, false);
+
     throw_if_canceled();
+    RuntimeTrace::InferScope trace_infer(m_runtime_trace.get(), graph.getGraphContext());
     if (m_asyncRequest->m_has_sub_infers) {
         sub_streams_infer();
         message->server_wait();
         return;
     }
 
-    convert_batched_tensors();
+    assemble_batched_inputs();
     if (!m_batched_tensors.empty()) {
         // batched_tensors will be updated for each infer, external_ptr should be update together
         update_external_tensor_ptrs();
@@ -126,7 +138,14 @@ void SyncInferRequest::infer() {
         redefine_memory_for_input_nodes(graph);
     }
 
-    change_default_ptr(graph);
+    if (m_input_staging && !inputs_staged) {
+        // synchronous inference, the inputs are converted on the critical path as without the staging
+        stage_inputs(graph);
+        staged_inputs = std::move(m_staged_inputs);
+        drop_staged_inputs();
+    }
+
+    change_default_ptr(graph, staged_inputs);
 
     throw_if_canceled();
 
@@ -135,7 +154,7 @@ void SyncInferRequest::infer() {
         graph.assignStates(m_memory_states);
     }
 
-    push_input_data(graph);
+    push_input_data(graph, staged_inputs);
 
     graph.Infer(this);
 
@@ -174,7 +193,8 @@ static inline void change_edge_ptr(const EdgePtr& edge, ov::SoPtr<ov::ITensor>&
     }
 }
 
-void SyncInferRequest::change_default_ptr(Graph& graph) {
+void SyncInferRequest::change_default_ptr(Graph& graph,
+                                          const std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>>& staged_inputs) {
     std::unordered_set<const void*> inputPtrs;
     std::function<void(const EdgePtr& edge, ov::SoPtr<ov::ITensor>& tensor)> changeInpPtr;
     if (graph.IsDynamic()) {
@@ -188,11 +208,11 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
         };
     }
 
-    for (auto& it : m_input_external_ptr) {
-        auto inputNodePtr = graph.getInputNodeByIndex(it.first);
-        OPENVINO_ASSERT(inputNodePtr, "Cannot find input tensor with index: ", it.first);
-        if (inputNodePtr->getDstDataAtPort(0) == it.second->data()) {
-            continue;
+    auto change_input_ptr = [&](const std::size_t index, ov::SoPtr<ov::ITensor> tensor) {
+        auto inputNodePtr = graph.getInputNodeByIndex(index);
+        OPENVINO_ASSERT(inputNodePtr, "Cannot find input tensor with index: ", index);
+        if (inputNodePtr->getDstDataAtPort(0) == tensor->data()) {
+            return;
         }
         const auto& childEdges = inputNodePtr->getChildEdges();
         // Perform checks that the user's memory will not be modified
@@ -230,9 +250,16 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
                 if (!e) {
                     OPENVINO_THROW("Node ", inputNodePtr->getName(), " contains empty child edge");
                 }
-                changeInpPtr(e, it.second);
+                changeInpPtr(e, tensor);
             }
         }
+    };
+    for (const auto& it : m_input_external_ptr) {
+        change_input_ptr(it.first, it.second);
+    }
+    // the staged inputs are never shared with the graph as the user tensors
+    for (const auto& it : staged_inputs) {
+        change_input_ptr(it.first, it.second);
     }
 
     for (auto& it : m_output_external_ptr) {
@@ -334,6 +361,10 @@ void SyncInferRequest::set_async_request(AsyncInferRequest* asyncRequest) {
     m_asyncRequest = asyncRequest;
 }
 
+void SyncInferRequest::enable_runtime_trace(const std::string& path_prefix) {
+    m_runtime_trace = std::make_unique<RuntimeTrace>(path_prefix);
+}
+
 void SyncInferRequest::throw_if_canceled() const {
     if (m_asyncRequest != nullptr) {
         m_asyncRequest->throw_if_canceled();
@@ -479,6 +510,59 @@ void SyncInferRequest::set_tensors_impl(const ov::Output<const ov::Node> port,
     OPENVINO_THROW("Cannot find port to set_tensors!");
 }
 
+namespace {
+// Returns the batch tensor sharing the memory of the items if they are continuous host tensors
+// placed one after another, e.g. the views of the frames of one buffer
+ov::SoPtr<ov::ITensor> make_batch_view(const std::vector<ov::SoPtr<ov::ITensor>>& tensors, const ov::Shape& batch_shape) {
+    const auto item_size = tensors[0]->get_byte_size();
+    const auto* begin = static_cast<const uint8_t*>(tensors[0]->data());
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        const auto& tensor = tensors[i];
+        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) || !tensor->is_continuous() ||
+            static_cast<const uint8_t*>(tensor->data()) != begin + i * item_size) {
+            return {};
+        }
+    }
+    return {ov::make_tensor(tensors[0]->get_element_type(), batch_shape, tensors[0]->data()), tensors[0]._so};
+}
+}  // namespace
+
+void SyncInferRequest::assemble_batched_inputs() {
+    for (const auto& [input_index, port] : m_input_ports_map) {
+        auto batched = m_batched_tensors.find(port.get_tensor_ptr());
+        if (batched == m_batched_tensors.end()) {
+            continue;
+        }
+        const auto& tensors = batched->second;
+        OPENVINO_ASSERT(tensors.at(0), "Unintialized tensor is provided!");
+        auto batch_shape = tensors[0]->get_shape();
+        batch_shape[0] = tensors.size();
+        const auto& element_type = tensors[0]->get_element_type();
+
+        auto& input_tensor = get_tensor_ptr(port);
+        if (auto view = make_batch_view(tensors, batch_shape)) {
+            input_tensor = view;
+            continue;
+        }
+
+        auto& buffer = m_batched_inputs[input_index];
+        if (!buffer || buffer->get_shape() != batch_shape || buffer->get_element_type() != element_type) {
+            buffer = {ov::make_tensor(element_type, batch_shape), nullptr};
+        }
+        const auto item_size = tensors[0]->get_byte_size();
+        auto* dst = static_cast<uint8_t*>(buffer->data());
+        parallel_for(tensors.size(), [&](size_t i) {
+            const auto& tensor = tensors[i];
+            if (tensor->is_continuous()) {
+                std::memcpy(dst + i * item_size, tensor->data(), item_size);
+            } else {
+                tensor->copy_to(ov::make_tensor(element_type, tensor->get_shape(), dst + i * item_size));
+            }
+        });
+        input_tensor = buffer;
+    }
+}
+
 void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyncInferRequest::FoundPort::Type& type) {
     OV_ITT_SCOPED_TASK(itt::domains::ov_intel_cpu, "init_tensor");
     auto&& graph = m_compiled_model.graph();
@@ -600,13 +684,53 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
     OPENVINO_ASSERT(tensor, "Cannot find tensor with index: ", port_index);
 }
 
-void SyncInferRequest::push_input_data(Graph& graph) {
+void SyncInferRequest::push_input_data(Graph& graph,
+                                       const std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>>& staged_inputs) {
     for (auto& input : m_input_ports_map) {
-        const auto& tensor = get_tensor_ptr(input.second);
+        const auto staged = staged_inputs.find(input.first);
+        const auto& tensor = staged != staged_inputs.end() ? staged->second : get_tensor_ptr(input.second);
         graph.PushInputData(input.first, tensor);
     }
 }
 
+void SyncInferRequest::stage_inputs() {
+    auto graphLock = m_compiled_model.lock();
+    stage_inputs(graphLock._graph);
+}
+
+void SyncInferRequest::stage_inputs(const Graph& graph) {
+    m_staged_inputs.clear();
+    for (const auto& [input_index, port] : m_input_ports_map) {
+        if (m_input_external_ptr.count(input_index) || m_batched_tensors.count(port.get_tensor_ptr())) {
+            continue;
+        }
+        const auto& tensor = get_tensor_ptr(port);
+        auto inputNode = graph.getInputNodeByIndex(input_index);
+        if (!inputNode || inputNode->isDynamicNode() || !tensor->is_continuous()) {
+            continue;
+        }
+        const auto& srcPrecision = tensor->get_element_type();
+        const auto dstPrecision = inputNode->getBaseMemDescAtOutputPort(0)->getPrecision();
+        if (srcPrecision == dstPrecision || any_of(element::string, srcPrecision, dstPrecision)) {
+            continue;
+        }
+
+        auto& buffer = m_staging_buffers[input_index];
+        if (!buffer || buffer->get_shape() != tensor->get_shape() || buffer->get_element_type() != dstPrecision) {
+            auto desc = std::make_shared<CpuBlockedMemoryDesc>(dstPrecision, Shape{tensor->get_shape()});
+            buffer = {std::make_shared<Tensor>(std::make_shared<Memory>(graph.getEngine(), desc)), nullptr};
+        }
+        cpu_convert(tensor->data(), buffer->data(), srcPrecision, dstPrecision, tensor->get_size());
+        m_staged_inputs[input_index] = buffer;
+    }
+    m_inputs_staged = true;
+}
+
+void SyncInferRequest::drop_staged_inputs() {
+    m_staged_inputs.clear();
+    m_inputs_staged = false;
+}
+
 SyncInferRequest::OutputControlBlock::OutputControlBlock(const ov::element::Type& precision, const Shape& shape) {
     dnnl::engine eng(dnnl::engine::kind::cpu, 0);
     m_buffers[m_buffIndx] = std::make_shared<MemoryBlockWithReuse>();
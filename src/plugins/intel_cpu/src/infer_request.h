@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -26,6 +27,7 @@
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "proxy_mem_blk.h"
+#include "runtime_trace.h"
 
 namespace ov::intel_cpu {
 
@@ -63,6 +65,30 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Converts the inputs, which can't be shared with the graph because of the precision mismatch, into
+     * the request-owned staging buffers, so the next inference doesn't convert them. Doesn't access the graph memory,
+     * thus it may run while the stream infers another request. Holds the graph lock, as the inference does, so
+     * the graph isn't recreated for a new streams layout meanwhile.
+     */
+    void stage_inputs();
+
+    /**
+     * @brief Drops the inputs converted by stage_inputs() which haven't been consumed by an inference, e.g. since
+     * the staging failed or the inference was performed by the coalescer
+     */
+    void drop_staged_inputs();
+
+    /**
+     * @brief Records the timeline of the inferences of the request, which is written to the trace file
+     * <path_prefix>_<n>.json when the request is destroyed
+     */
+    void enable_runtime_trace(const std::string& path_prefix);
+
+    [[nodiscard]] RuntimeTrace* runtime_trace() const {
+        return m_runtime_trace.get();
+    }
+
 private:
     class OutputControlBlock {
     public:
@@ -110,10 +136,13 @@ private:
     void create_infer_request();
     void init_tensor(const std::size_t& port_index, const ov::ISyncInferRequest::FoundPort::Type& type);
 
-    void push_input_data(Graph& graph);
+    void push_input_data(Graph& graph, const std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>>& staged_inputs);
+    void assemble_batched_inputs();
     void redefine_memory_for_input_nodes(Graph& graph);
+    // stages the inputs for the graph locked by the caller
+    void stage_inputs(const Graph& graph);
     void update_external_tensor_ptrs();
-    void change_default_ptr(Graph& graph);
+    void change_default_ptr(Graph& graph, const std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>>& staged_inputs);
 
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
 
@@ -123,10 +152,18 @@ private:
 
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
+    // batch buffers of the inputs set by set_tensors, reused between the inferences
+    std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_batched_inputs;
+    // the inputs converted by stage_inputs(), they replace the user tensors in the next inference
+    std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_staged_inputs;
+    std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_staging_buffers;
+    bool m_input_staging = false;
+    bool m_inputs_staged = false;
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
     AsyncInferRequest* m_asyncRequest = nullptr;
+    std::unique_ptr<RuntimeTrace> m_runtime_trace;
     CompiledModelHolder m_compiled_model;
 
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
@@ -73,6 +73,18 @@ static constexpr Property<SnippetsMode, PropertyMutability::RW> snippets_mode{"S
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"ENABLE_TENSOR_PARALLEL"};
 
+/**
+ * @brief Defines the number of the rows of the output computed by a chunk of the tensor parallel FullyConnected
+ * layers. Each sub-stream computes its slice of the output channels chunk by chunk and gathers the chunks of
+ * the other sub-streams which are ready between its own chunks, so the exchange of the slices overlaps with
+ * the computation instead of following it.
+ * The outputs with no more rows than a chunk aren't chunked, so the decoding, which computes a few rows per step,
+ * gets no overlap and keeps exchanging the slices after the computation. The property only speeds up the prefill
+ * and the other steps with more rows than a chunk.
+ * @param 0 - the slices are exchanged once computed entirely (default)
+ */
+static constexpr Property<size_t, PropertyMutability::RW> tensor_parallel_chunk_rows{"TENSOR_PARALLEL_CHUNK_ROWS"};
+
 /**
  * @brief Define whether to enable sage_attn
  * @param true - enable
@@ -80,4 +92,218 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Defines how many experts of each MoE GatherMatmul layer are kept repacked in memory.
+ * The weights of the other experts stay in the original constants, which are file-backed when the model is read
+ * with mmap, and are repacked on demand into a least recently used cache of this size.
+ * @param 0 - repack and keep all the experts weights (default)
+ */
+static constexpr Property<size_t, PropertyMutability::RW> moe_experts_cache_size{"MOE_EXPERTS_CACHE_SIZE"};
+
+/**
+ * @brief Defines whether the asynchronous infer requests convert the inputs, which can't be shared with the graph
+ * because of the precision mismatch, into a request-owned buffer on a separate staging executor, with a stream per
+ * inference stream, before the inference task is scheduled to the stream. The conversion of a request then overlaps
+ * the inference of the previous request of the stream instead of being on its critical path.
+ * @param false - the inputs are converted by the inference task (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> async_input_staging{"ASYNC_INPUT_STAGING"};
+
+/**
+ * @brief Defines the latency budget in microseconds of the coalescing of the concurrent asynchronous infer requests.
+ * The requests of a model with a dynamic batch dimension of all the inputs and outputs, which are started within
+ * the budget and have the same shapes of the other dimensions, are inferred by a single graph execution with the inputs
+ * concatenated along the batch dimension, the outputs are split back into the requests. The model must not mix
+ * the items of the batch.
+ * @param 0 - the requests are inferred separately (default)
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> coalesce_requests_timeout{"COALESCE_REQUESTS_TIMEOUT"};
+
+/**
+ * @brief Defines the maximum total batch of the coalesced infer requests, see coalesce_requests_timeout
+ * @param 16 - default
+ */
+static constexpr Property<size_t, PropertyMutability::RW> coalesce_requests_max_batch{"COALESCE_REQUESTS_MAX_BATCH"};
+
+/**
+ * @brief Defines the directory of the files backing the KV cache of the stateful SDPA. The cache pages of idle or long
+ * sessions are then written back to the files and reclaimed by the OS under memory pressure, and are read back on
+ * demand by the attention kernels, instead of exhausting the host memory. Supported on Linux only.
+ * @param "" - the KV cache is kept in the host memory (default)
+ */
+static constexpr Property<std::string, PropertyMutability::RW> kv_cache_spill_dir{"KV_CACHE_SPILL_DIR"};
+
+/**
+ * @brief Defines the number of the most recent tokens whose KV cache is hot, the cache of the older tokens stored in
+ * ov::intel_cpu::kv_cache_spill_dir is marked as cold, so it's the first to be reclaimed.
+ * @param 0 - all the tokens are treated equally (default)
+ */
+static constexpr Property<size_t, PropertyMutability::RW> kv_cache_hot_window{"KV_CACHE_HOT_WINDOW"};
+
+/**
+ * @brief Defines the sliding window of the KV cache of the stateful SDPA. Once a session exceeds the window, the cache
+ * keeps only the ov::intel_cpu::kv_cache_sink_tokens first tokens and the window of the most recent tokens, the others
+ * are evicted in place. The memory and the per-token latency of long sessions are then bounded. The attention mask
+ * of all the session tokens is accepted, the columns of the evicted tokens are dropped.
+ * @param 0 - the cache keeps all the tokens (default)
+ */
+static constexpr Property<size_t, PropertyMutability::RW> kv_cache_window_size{"KV_CACHE_WINDOW_SIZE"};
+
+/**
+ * @brief Defines the number of the first tokens of a session which are never evicted from the KV cache by the sliding
+ * window ov::intel_cpu::kv_cache_window_size. They serve as the attention sinks which keep the attention of the long
+ * sessions stable.
+ * @param 4 - default
+ */
+static constexpr Property<size_t, PropertyMutability::RW> kv_cache_sink_tokens{"KV_CACHE_SINK_TOKENS"};
+
+/**
+ * @brief Enum to define the weights compression modes applied by the plugin at the model compilation.
+ */
+enum class WeightsCompressionMode : uint8_t {
+    DISABLE = 0,    //!<  The weights are kept as is
+    INT8_SYM = 1,   //!<  i8 weights with per-group scales
+    INT8_ASYM = 2,  //!<  u8 weights with per-group scales and zero points
+    INT4_SYM = 3,   //!<  i4 weights with per-group scales
+    INT4_ASYM = 4,  //!<  u4 weights with per-group scales and zero points
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsCompressionMode& mode) {
+    switch (mode) {
+    case WeightsCompressionMode::DISABLE:
+        return os << "DISABLE";
+    case WeightsCompressionMode::INT8_SYM:
+        return os << "INT8_SYM";
+    case WeightsCompressionMode::INT8_ASYM:
+        return os << "INT8_ASYM";
+    case WeightsCompressionMode::INT4_SYM:
+        return os << "INT4_SYM";
+    case WeightsCompressionMode::INT4_ASYM:
+        return os << "INT4_ASYM";
+    default:
+        OPENVINO_THROW("Unsupported weights compression mode value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsCompressionMode& mode) {
+    std::string str;
+    is >> str;
+    if (str == "DISABLE") {
+        mode = WeightsCompressionMode::DISABLE;
+    } else if (str == "INT8_SYM") {
+        mode = WeightsCompressionMode::INT8_SYM;
+    } else if (str == "INT8_ASYM") {
+        mode = WeightsCompressionMode::INT8_ASYM;
+    } else if (str == "INT4_SYM") {
+        mode = WeightsCompressionMode::INT4_SYM;
+    } else if (str == "INT4_ASYM") {
+        mode = WeightsCompressionMode::INT4_ASYM;
+    } else {
+        OPENVINO_THROW("Unsupported weights compression mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the data-free compression of the f32/f16/bf16 weights of MatMul layers executed as FullyConnected.
+ * The plugin quantizes the weights at the model compilation and inserts the decompression subgraph, which is then
+ * handled by the compressed FullyConnected executors the same way as the weights compressed offline. The compressed
+ * weights are stored in the model cache.
+ * @param DISABLE - the weights are kept as is (default)
+ */
+static constexpr Property<WeightsCompressionMode, PropertyMutability::RW> weights_compression_mode{
+    "WEIGHTS_COMPRESSION_MODE"};
+
+/**
+ * @brief Defines the number of the input channels sharing a scale and a zero point of the weights compressed by
+ * ov::intel_cpu::weights_compression_mode. The weights whose input channels can't be split into the groups are
+ * compressed per output channel.
+ * @param 0 - per output channel compression
+ * @param 128 - default
+ */
+static constexpr Property<size_t, PropertyMutability::RW> weights_compression_group_size{
+    "WEIGHTS_COMPRESSION_GROUP_SIZE"};
+
+/**
+ * @brief Defines whether the FullyConnected layers with the f32 constant weights which have the 2:4 structured
+ * sparsity, i.e. at most 2 nonzero values in each group of 4 consecutive input channels, are executed by the sparse
+ * kernels. Such weights are stored as the nonzero values with their positions in the groups and the zero values are
+ * skipped by the computation. The weights which don't have the pattern are executed as usual. The sparse kernels
+ * don't block the rows of the source, so they pay off for the small number of rows, e.g. the token generation, and
+ * the option is disabled by default.
+ * @param false - default
+ */
+static constexpr Property<bool, PropertyMutability::RW> fc_structured_sparse_weights{"FC_STRUCTURED_SPARSE_WEIGHTS"};
+
+/**
+ * @brief Defines whether the repacking of the constant weights into the layouts of the FullyConnected, Convolution
+ * and MatMul primitives is deferred from the model compilation until each layer is executed first. A background
+ * thread repacks the weights of the upcoming layers ahead of the execution, so the first inference doesn't wait for
+ * the weights of the whole model to be repacked. The repacked weights are shared through the weights cache.
+ * @param false - the weights are repacked at the model compilation (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> defer_weights_repacking{"DEFER_WEIGHTS_REPACKING"};
+
+/**
+ * @brief Enum to define the placement of the repacked weights over the NUMA nodes of a latency stream spanning several
+ * NUMA nodes.
+ */
+enum class WeightsNumaPlacement : uint8_t {
+    STREAM = 0,      //!<  The weights are moved to the NUMA node the stream is assigned to
+    INTERLEAVE = 1,  //!<  The pages of the weights are interleaved over the NUMA nodes of the stream
+    PARTITION = 2,   //!<  The weights are partitioned into contiguous slices, one per NUMA node of the stream
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsNumaPlacement& placement) {
+    switch (placement) {
+    case WeightsNumaPlacement::STREAM:
+        return os << "STREAM";
+    case WeightsNumaPlacement::INTERLEAVE:
+        return os << "INTERLEAVE";
+    case WeightsNumaPlacement::PARTITION:
+        return os << "PARTITION";
+    default:
+        OPENVINO_THROW("Unsupported weights NUMA placement value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsNumaPlacement& placement) {
+    std::string str;
+    is >> str;
+    if (str == "STREAM") {
+        placement = WeightsNumaPlacement::STREAM;
+    } else if (str == "INTERLEAVE") {
+        placement = WeightsNumaPlacement::INTERLEAVE;
+    } else if (str == "PARTITION") {
+        placement = WeightsNumaPlacement::PARTITION;
+    } else {
+        OPENVINO_THROW("Unsupported weights NUMA placement: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the placement of the repacked constant weights when a single latency stream spans several NUMA nodes,
+ * e.g. on a multi-socket host. The weights spread over the NUMA nodes are read through the memory controllers of all
+ * the nodes. The slices of the PARTITION placement follow the number of the threads of the stream on each NUMA node,
+ * so the slices of the weights whose output channels are the outermost dimension are local to the threads computing
+ * them with the static partition of the output channels. The weights of the tensor parallel sub-streams are split per
+ * socket anyway and aren't affected.
+ * @param STREAM - default
+ */
+static constexpr Property<WeightsNumaPlacement, PropertyMutability::RW> weights_numa_placement{
+    "WEIGHTS_NUMA_PLACEMENT"};
+
+/**
+ * @brief Defines the number of bytes of the repacked weights of the next layer which are prefetched into the last
+ * level cache while the current layer with the weights is executed. The prefetch hints are issued by the calling thread
+ * of the stream before the current layer, with the partitioned placement only the slice of its NUMA node is prefetched.
+ * @param 0 - the weights aren't prefetched (default)
+ */
+static constexpr Property<size_t, PropertyMutability::RW> weights_prefetch_size{"WEIGHTS_PREFETCH_SIZE"};
+
 }  // namespace ov::intel_cpu
@@ -57,6 +57,7 @@
 #include "utils/general_utils.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/rt_info/memory_formats_attribute.hpp"
+#include "weights_placement.hpp"
 
 using namespace dnnl;
 using namespace openvino;
@@ -811,6 +812,7 @@ void Node::updateDynamicParams() {
                           " ",
                           getOriginalLayers());
                 context->getCpuParallel()->activate();
+                WeightsPlacement::Scope placeWeights(context->getWeightsPlacement(), this);
                 prepareParams();
             }
         }
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tensor_parallel_chunks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "cpu_memcpy.h"
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "sub_memory_manager.hpp"
+
+namespace ov::intel_cpu {
+
+TensorParallelChunks TensorParallelChunks::create(const VectorDims& srcDims, size_t chunkRows) {
+    TensorParallelChunks chunks;
+    if (chunkRows == 0 || srcDims.size() < 2) {
+        return chunks;
+    }
+    const auto rows = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<>());
+    if (rows <= chunkRows) {
+        return chunks;
+    }
+    for (size_t dim = 0; dim + 1 < srcDims.size(); dim++) {
+        if (srcDims[dim] > 1) {
+            chunks.dim = dim;
+            chunks.units = srcDims[dim];
+            chunks.unitRows =
+                std::accumulate(srcDims.begin() + dim + 1, srcDims.end() - 1, size_t{1}, std::multiplies<>());
+            chunks.chunkUnits = std::max(size_t{1}, chunkRows / chunks.unitRows);
+            break;
+        }
+    }
+    return chunks;
+}
+
+TensorParallelGather::TensorParallelGather(size_t rows, std::vector<int> channels, size_t precisionSize)
+    : m_rows(rows),
+      m_channels(std::move(channels)),
+      m_precisionSize(precisionSize),
+      m_gatheredRows(m_channels.size(), 0) {
+    m_rowSize = std::accumulate(m_channels.begin(), m_channels.end(), size_t{0}) * m_precisionSize;
+}
+
+bool TensorParallelGather::gather(uint8_t* dst,
+                                  const std::vector<SubMemoryManager::MemoryInfo>& memorys,
+                                  const std::vector<std::atomic<size_t>>& readyRows,
+                                  const CpuParallel& cpuParallel) {
+    bool gathered = true;
+    size_t offset = 0;
+    for (size_t idx = 0; idx < m_channels.size(); idx++) {
+        const auto first = m_gatheredRows[idx];
+        const auto ready = readyRows[idx].load(std::memory_order_acquire);
+        const auto copySize = static_cast<size_t>(m_channels[idx]) * m_precisionSize;
+        if (ready > first) {
+            const auto* src = static_cast<const uint8_t*>(memorys[idx].send_buf);
+            cpuParallel.parallel_for(ready - first, [&](size_t i) {
+                cpu_memcpy(dst + (first + i) * m_rowSize + offset, src + (first + i) * copySize, copySize);
+            });
+            m_gatheredRows[idx] = ready;
+        }
+        offset += copySize;
+        gathered = gathered && m_gatheredRows[idx] == m_rows;
+    }
+    return gathered;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "sub_memory_manager.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * The chunks of the rows of the tensor parallel FullyConnected output. The source is chunked by its outermost non-unit
+ * dimension, so a chunk is contiguous in both the source and the output slice of a sub-stream.
+ */
+struct TensorParallelChunks {
+    // returns the empty chunks if the output isn't chunked, e.g. it has no more rows than a chunk at the decoding
+    static TensorParallelChunks create(const VectorDims& srcDims, size_t chunkRows);
+
+    [[nodiscard]] bool empty() const {
+        return units == 0;
+    }
+
+    [[nodiscard]] size_t rows() const {
+        return units * unitRows;
+    }
+
+    // the indices of the chunked dimension in the last chunk, 0 if all the chunks are full
+    [[nodiscard]] size_t tailUnits() const {
+        return units % chunkUnits;
+    }
+
+    size_t dim = 0;
+    // the size of the chunked dimension
+    size_t units = 0;
+    // the rows of a single index of the chunked dimension
+    size_t unitRows = 0;
+    // the indices of the chunked dimension in a full chunk
+    size_t chunkUnits = 0;
+};
+
+/**
+ * Copies the rows of the output slices published by the sub-streams into the full output. Each sub-stream computes
+ * the slice of the output channels and publishes the number of its ready rows.
+ */
+class TensorParallelGather {
+public:
+    TensorParallelGather(size_t rows, std::vector<int> channels, size_t precisionSize);
+
+    // copies the rows published since the previous call, returns true once all the rows are copied
+    bool gather(uint8_t* dst,
+                const std::vector<SubMemoryManager::MemoryInfo>& memorys,
+                const std::vector<std::atomic<size_t>>& readyRows,
+                const CpuParallel& cpuParallel);
+
+private:
+    const size_t m_rows;
+    const std::vector<int> m_channels;
+    const size_t m_precisionSize;
+    size_t m_rowSize = 0;
+    std::vector<size_t> m_gatheredRows;
+};
+
+}  // namespace ov::intel_cpu
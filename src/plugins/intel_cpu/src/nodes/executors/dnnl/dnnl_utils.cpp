@@ -11,6 +11,7 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 
 #include "cache/multi_cache.h"
@@ -24,9 +25,97 @@
 #include "openvino/core/type/element_type.hpp"
 #include "thread_pool_imp.hpp"
 #include "weights_cache.hpp"
+#include "weights_repacker.hpp"
 
 namespace ov::intel_cpu::utils {
 
+static void fillWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
+                              const MemoryCPtr& weightsMem,
+                              const MemoryPtr& dstMemory,
+                              const dnnl::engine& eng,
+                              const MultiCachePtr& rtCache,
+                              const std::shared_ptr<ThreadPool>& threadPool,
+                              bool needShiftSignedToUnsigned) {
+    // https://oneapi-src.github.io/oneDNN/dev_guide_int8_computations.html?highlight=128#inputs-of-the-same-type-s8
+    auto src_wdt = srcWeightDesc->getPrecision();
+    auto dst_wdt = dstMemory->getDesc().getPrecision();
+    if (needShiftSignedToUnsigned && src_wdt.is_integral_number() && src_wdt.is_signed() &&
+        dst_wdt.is_integral_number() && !dst_wdt.is_signed()) {
+        assert(src_wdt.bitwidth() == dst_wdt.bitwidth());
+
+        // prevent reorderData from doing conversion
+        Memory srcMemory{eng, srcWeightDesc->cloneWithNewPrecision(dst_wdt), weightsMem->getData()};
+        node::Reorder::reorderData(srcMemory, *dstMemory, rtCache, threadPool);
+
+        // do shift
+        auto count = dstMemory->getSize() / dst_wdt.size();
+        if (dst_wdt == ov::element::u8) {
+            auto* data = dstMemory->getDataAs<uint8_t>();
+            for (size_t i = 0; i < count; i++) {
+                data[i] = data[i] + 128;
+            }
+        } else if (dst_wdt == ov::element::u4) {
+            auto* data = dstMemory->getDataAs<uint8_t>();
+            for (size_t i = 0; i < count; i++) {
+                auto low = (data[i] & 0xF) + 8;
+                auto high = (data[i] >> 4) + 8;
+                data[i] = (high << 4) | (low & 0xF);
+            }
+        } else {
+            OPENVINO_THROW("Unsupported data type for shiftting sign to unsign");
+        }
+        return;
+    }
+
+    Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
+    node::Reorder::reorderData(srcMemory, *dstMemory, rtCache, threadPool);
+}
+
+// Allocates the packed weights and defers the packing itself until the node is executed first
+static MemoryPtr prepareWeightsMemoryDeferred(const DnnlMemoryDescPtr& srcWeightDesc,
+                                              const DnnlMemoryDescPtr& dstWeightDesc,
+                                              const MemoryCPtr& weightsMem,
+                                              const ExecutorContext::CPtr& context,
+                                              const bool needShiftSignedToUnsigned) {
+    const auto& privateWeightCache = context->getPrivateWeightCache();
+    const auto format = dstWeightDesc->serializeFormat();
+    auto itr = privateWeightCache->find(format);
+    if (privateWeightCache->end() != itr) {
+        return itr->second;
+    }
+
+    const auto& eng = context->getEngine();
+    auto allocate = [&]() {
+        return std::make_shared<Memory>(eng, dstWeightDesc);
+    };
+    // the packing may run in the background thread, so neither the primitive cache nor the stream thread pool is used
+    auto fill = [srcWeightDesc, weightsMem, eng, needShiftSignedToUnsigned](const MemoryPtr& dstMemory) {
+        fillWeightsMemory(srcWeightDesc, weightsMem, dstMemory, eng, nullptr, nullptr, needShiftSignedToUnsigned);
+    };
+
+    MemoryPtr ptr;
+    WeightsSharing::DeferredFill::Ptr deferredFill;
+    const auto& globalWeightCache = context->getWeightsCache();
+    if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
+        std::tie(ptr, deferredFill) = globalWeightCache->findOrCreateDeferred(
+            DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
+            allocate,
+            fill);
+    } else {
+        ptr = allocate();
+        deferredFill = std::make_shared<WeightsSharing::DeferredFill>([weakPtr = std::weak_ptr<IMemory>(ptr), fill]() {
+            if (auto dstMemory = weakPtr.lock()) {
+                fill(dstMemory);
+            }
+        });
+    }
+
+    context->getWeightsRepacker()->defer(deferredFill);
+    (*privateWeightCache)[format] = ptr;
+
+    return ptr;
+}
+
 MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
                                const DnnlMemoryDescPtr& dstWeightDesc,
                                const MemoryCPtr& weightsMem,
@@ -35,15 +124,32 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
     const auto privateWeightCache = context->getPrivateWeightCache();
     OPENVINO_ASSERT(privateWeightCache, "privateWeightCache is nullptr");
 
-    return prepareWeightsMemory(srcWeightDesc,
-                                dstWeightDesc,
-                                weightsMem,
-                                context->getEngine(),
-                                context->getRuntimeCache(),
-                                context->getWeightsCache(),
-                                privateWeightCache,
-                                context->getThreadPool(),
-                                needShiftSignedToUnsigned);
+    MemoryPtr ptr;
+    const auto& repacker = context->getWeightsRepacker();
+    if (repacker && repacker->isCollecting()) {
+        ptr = prepareWeightsMemoryDeferred(srcWeightDesc,
+                                           dstWeightDesc,
+                                           weightsMem,
+                                           context,
+                                           needShiftSignedToUnsigned);
+    } else {
+        ptr = prepareWeightsMemory(srcWeightDesc,
+                                   dstWeightDesc,
+                                   weightsMem,
+                                   context->getEngine(),
+                                   context->getRuntimeCache(),
+                                   context->getWeightsCache(),
+                                   privateWeightCache,
+                                   context->getThreadPool(),
+                                   needShiftSignedToUnsigned);
+    }
+
+    // the pages of the deferred weights are not filled yet, so they follow the placement once filled
+    if (const auto& placement = context->getWeightsPlacement()) {
+        placement->place(ptr);
+    }
+
+    return ptr;
 }
 
 MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
@@ -64,42 +170,8 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
     }
 
     auto create = [&]() {
-        // https://oneapi-src.github.io/oneDNN/dev_guide_int8_computations.html?highlight=128#inputs-of-the-same-type-s8
-        auto src_wdt = srcWeightDesc->getPrecision();
-        auto dst_wdt = dstWeightDesc->getPrecision();
-        if (needShiftSignedToUnsigned && src_wdt.is_integral_number() && src_wdt.is_signed() &&
-            dst_wdt.is_integral_number() && !dst_wdt.is_signed()) {
-            assert(src_wdt.bitwidth() == dst_wdt.bitwidth());
-
-            // prevent reorderData from doing conversion
-            Memory srcMemory{eng, srcWeightDesc->cloneWithNewPrecision(dst_wdt), weightsMem->getData()};
-            MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
-            node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
-
-            // do shift
-            auto count = _ptr->getSize() / _ptr->getDesc().getPrecision().size();
-            if (dst_wdt == ov::element::u8) {
-                auto* data = _ptr->getDataAs<uint8_t>();
-                for (size_t i = 0; i < count; i++) {
-                    data[i] = data[i] + 128;
-                }
-            } else if (dst_wdt == ov::element::u4) {
-                auto* data = _ptr->getDataAs<uint8_t>();
-                for (size_t i = 0; i < count; i++) {
-                    auto low = (data[i] & 0xF) + 8;
-                    auto high = (data[i] >> 4) + 8;
-                    data[i] = (high << 4) | (low & 0xF);
-                }
-            } else {
-                OPENVINO_THROW("Unsupported data type for shiftting sign to unsign");
-            }
-            return _ptr;
-        }
-
-        Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
         MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
-
+        fillWeightsMemory(srcWeightDesc, weightsMem, _ptr, eng, rtCache, threadPool, needShiftSignedToUnsigned);
         return _ptr;
     };
 
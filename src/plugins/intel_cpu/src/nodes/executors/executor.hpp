@@ -23,6 +23,8 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/visibility.hpp"
 #include "weights_cache.hpp"
+#include "weights_placement.hpp"
+#include "weights_repacker.hpp"
 
 namespace ov::intel_cpu {
 
@@ -58,6 +60,8 @@ public:
         : runtimeCache(graphContext->getParamsCache()),
           scratchPads(graphContext->getScratchPads()),
           weightsCache(graphContext->getWeightsCache()),
+          weightsRepacker(graphContext->getWeightsRepacker()),
+          weightsPlacement(graphContext->getWeightsPlacement()),
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
@@ -93,6 +97,14 @@ public:
         return weightsCache;
     }
 
+    [[nodiscard]] const WeightsRepacker::Ptr& getWeightsRepacker() const {
+        return weightsRepacker;
+    }
+
+    [[nodiscard]] const WeightsPlacement::Ptr& getWeightsPlacement() const {
+        return weightsPlacement;
+    }
+
     [[nodiscard]] std::shared_ptr<ThreadPool> getThreadPool() const {
         return cpuParallel->get_thread_pool();
     }
@@ -103,6 +115,8 @@ private:
     MultiCacheWeakPtr runtimeCache;
     std::vector<DnnlScratchPadPtr> scratchPads;
     WeightsSharing::Ptr weightsCache;
+    WeightsRepacker::Ptr weightsRepacker;
+    WeightsPlacement::Ptr weightsPlacement;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
     // @todo remove after global cache is used exclusevly
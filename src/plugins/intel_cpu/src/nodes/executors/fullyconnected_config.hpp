@@ -16,6 +16,8 @@ namespace ov::intel_cpu {
 struct FCAttrs {
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
+    // constant weights have the 2:4 structured sparsity along the input channels
+    bool structuredSparseWeights = false;
     uint64_t dynamicQuantizationGroupSize = 0;
     bool constantWeights = true;
 
@@ -58,17 +58,23 @@ static MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
         return _ptr;
     };
 
+    MemoryPtr packed;
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
         std::string format = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K);
         const std::string string_hash = format + "_" + std::to_string(weightsMemory->getSize()) + "_" +
                                         std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
         DEBUG_LOG("MlasGemmExecutor: findOrCreate, string_hash: ", string_hash);
-        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+        packed = MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    } else {
+        DEBUG_LOG("MlasGemmExecutor: Weights cache is not available");
+        packed = create();
     }
 
-    DEBUG_LOG("MlasGemmExecutor: Weights cache is not available");
-    return create();
+    if (const auto& placement = context->getWeightsPlacement()) {
+        placement->place(packed);
+    }
+    return packed;
 }
 
 // @todo use VERIFY macro for the checks
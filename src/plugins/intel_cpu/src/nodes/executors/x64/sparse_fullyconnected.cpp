@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fullyconnected.hpp"
+
+#include <algorithm>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/sparse_fc.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace ov::element;
+using ov::Extensions::Cpu::XARCH::sparse_fc_oc_block;
+
+// rows of the source processed by a single task
+static constexpr size_t rowsPerTask = 64;
+
+// packed weights of a block of output channels: values[K / 4][2][oc_block] followed by indices[K / 4][2][oc_block]
+static size_t packedBlockValues(size_t K) {
+    return K / 4 * 2 * sparse_fc_oc_block;
+}
+
+static MemoryPtr prepareWeightMemory(const MemoryPtr& weightsMemory,
+                                     const ExecutorContext::CPtr& context,
+                                     const bool weightsNonTransposed) {
+    DEBUG_LOG("SparseFCExecutor: pack weights");
+    const auto& wgtDims = weightsMemory->getStaticDims();
+    const size_t N = weightsNonTransposed ? wgtDims[1] : wgtDims[0];
+    const size_t K = weightsNonTransposed ? wgtDims[0] : wgtDims[1];
+    const size_t blocks = div_up(N, sparse_fc_oc_block);
+    const size_t blockValues = packedBlockValues(K);
+    const size_t packedSize = blocks * blockValues * (sizeof(float) + sizeof(uint8_t));
+
+    auto create = [&]() {
+        const auto* weightPtr = weightsMemory->getDataAs<const float>();
+        MemoryPtr _ptr = std::make_shared<Memory>(context->getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(u8, intel_cpu::Shape{packedSize}));
+        auto* values = _ptr->getDataAs<float>();
+        auto* indices = reinterpret_cast<uint8_t*>(values + blocks * blockValues);
+        DEBUG_LOG("SparseFCExecutor: cache miss, perform packing");
+        ov::parallel_for(blocks, [&](size_t b) {
+            auto* blockValuesPtr = values + b * blockValues;
+            auto* blockIndicesPtr = indices + b * blockValues;
+            for (size_t kb = 0; kb < K / 4; kb++) {
+                for (size_t oc = 0; oc < sparse_fc_oc_block; oc++) {
+                    // the unused slots and the padded output channels keep zero values
+                    float slotValues[2] = {0.F, 0.F};
+                    uint8_t slotIndices[2] = {0, 0};
+                    const size_t n = b * sparse_fc_oc_block + oc;
+                    size_t slot = 0;
+                    for (size_t i = 0; n < N && i < 4; i++) {
+                        const size_t k = kb * 4 + i;
+                        const float value = weightsNonTransposed ? weightPtr[k * N + n] : weightPtr[n * K + k];
+                        if (value == 0.F) {
+                            continue;
+                        }
+                        OPENVINO_ASSERT(slot < 2,
+                                        "SparseFCExecutor: weights don't have 2:4 sparsity at output channel ",
+                                        n,
+                                        ", input channel ",
+                                        k);
+                        slotValues[slot] = value;
+                        slotIndices[slot] = static_cast<uint8_t>(i);
+                        slot++;
+                    }
+                    for (size_t s = 0; s < 2; s++) {
+                        blockValuesPtr[(kb * 2 + s) * sparse_fc_oc_block + oc] = slotValues[s];
+                        blockIndicesPtr[(kb * 2 + s) * sparse_fc_oc_block + oc] = slotIndices[s];
+                    }
+                }
+            }
+        });
+        return _ptr;
+    };
+
+    MemoryPtr packed;
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "sparse_fc_2_4_" + std::to_string(N) + "_" + std::to_string(K);
+        const std::string string_hash = format + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        DEBUG_LOG("SparseFCExecutor: findOrCreate, string_hash: ", string_hash);
+        packed = MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    } else {
+        DEBUG_LOG("SparseFCExecutor: Weights cache is not available");
+        packed = create();
+    }
+
+    if (const auto& placement = context->getWeightsPlacement()) {
+        placement->place(packed);
+    }
+    return packed;
+}
+
+bool SparseFCExecutor::supports(const FCConfig& config) {
+    VERIFY(config.attrs.structuredSparseWeights, " weights don't have structured sparsity");
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(config.attrs.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2), UNSUPPORTED_ISA);
+    VERIFY(all_of(f32, srcType(config), weiType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+
+    if (hasBias(config)) {
+        VERIFY(biaType(config) == f32, UNSUPPORTED_BIAS_PRECISIONS);
+        const auto& biasDims = config.descs.at(ARG_BIAS)->getShape().getDims();
+        const auto N = config.attrs.weightsNonTransposed ? weiDims(config)[1] : weiDims(config)[0];
+        VERIFY(biasDims.back() == N && std::all_of(biasDims.begin(),
+                                                   biasDims.end() - 1,
+                                                   [](const Dim dim) {
+                                                       return dim == 1;
+                                                   }),
+               "only 'by channel' bias is supported");
+    }
+
+    return true;
+}
+
+SparseFCExecutor::SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      packedWeights(prepareWeightMemory(memory.at(ARG_WEI), context, attrs.weightsNonTransposed)),
+      N(memory.at(ARG_WEI)->getStaticDims()[attrs.weightsNonTransposed ? 1 : 0]),
+      K(memory.at(ARG_WEI)->getStaticDims()[attrs.weightsNonTransposed ? 0 : 1]) {}
+
+impl_desc_type SparseFCExecutor::implType() const {
+    return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? impl_desc_type::jit_sparse_avx512
+                                                                              : impl_desc_type::jit_sparse_avx2;
+}
+
+bool SparseFCExecutor::update(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getDescPtr()->getShape().getStaticDims();
+    M = std::accumulate(srcDims.begin(), srcDims.end() - 1, static_cast<size_t>(1), std::multiplies<>());
+    return true;
+}
+
+void SparseFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto& biasMemory = memory.at(ARG_BIAS);
+    const auto* bias = biasMemory->getDesc().empty() ? nullptr : biasMemory->getDataAs<const float>();
+
+    const size_t blocks = div_up(N, sparse_fc_oc_block);
+    const size_t blockValues = packedBlockValues(K);
+    const auto* values = packedWeights->getDataAs<const float>();
+    const auto* indices = reinterpret_cast<const uint8_t*>(values + blocks * blockValues);
+
+    ov::parallel_for2d(div_up(M, rowsPerTask), blocks, [&](size_t mb, size_t b) {
+        const size_t m = mb * rowsPerTask;
+        const size_t n = b * sparse_fc_oc_block;
+        ov::Extensions::Cpu::XARCH::sparse_fc_2_4(src + m * K,
+                                                  K,
+                                                  std::min(rowsPerTask, M - m),
+                                                  K,
+                                                  values + b * blockValues,
+                                                  indices + b * blockValues,
+                                                  bias ? bias + n : nullptr,
+                                                  dst + m * N + n,
+                                                  N,
+                                                  std::min(sparse_fc_oc_block, N - n));
+    });
+}
+
+void SparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(packedWeights, numaNodeID);
+    if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
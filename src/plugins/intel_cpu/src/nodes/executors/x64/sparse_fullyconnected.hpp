@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * FullyConnected executor for the f32 weights with 2:4 structured sparsity.
+ * The weights are packed into the blocks of output channels keeping only 2 values of each group of 4 input channels
+ * with their positions in the group, so the computation and the weights memory traffic are halved.
+ */
+class SparseFCExecutor : public Executor {
+public:
+    SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    const MemoryArgs& m_memoryArgs;
+    const MemoryCPtr packedWeights;
+    size_t M = 0, N, K;
+    int curNumaNode = -1;
+};
+
+using SparseFCExecutorPtr = std::shared_ptr<SparseFCExecutor>;
+
+}  // namespace ov::intel_cpu
@@ -5,6 +5,7 @@
 #include "fullyconnected.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -31,6 +32,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
+#include "nodes/common/tensor_parallel_chunks.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/executor_factory.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
@@ -212,6 +214,7 @@ void FullyConnected::initTensorParallelConfig(const GraphContext::CPtr& context)
             tp_cfg.w_rank = context->getCPUStreamExecutor()->get_rank()[0];
             tp_cfg.w_size = ov::threading::message_manager()->get_num_sub_streams();
             tp_cfg.enable_tensor_parallel = tp_cfg.w_size > 1;
+            tp_cfg.chunk_rows = context->getConfig().tensorParallelChunkRows;
             tp_cfg.sub_memory = context->getSubMemory();
         }
     }
@@ -294,6 +297,7 @@ void FullyConnected::prepareParams() {
     needPrepareParamsForTensorParallel();
 
     executor->update(memory);
+    prepareTensorParallelChunks();
     // @todo avoid updating implementation type in scope of every prepareParams call.
     // Currently the tests are implemented in such way that the actual used implementation type is changed
     // based on a shape and the expected implementation type is determined by the last shape.
@@ -312,6 +316,7 @@ void FullyConnected::initTensorParallelSync() {
                 tp_cfg.sub_memory->_use_count[tp_cfg.id] = 0;
                 for (int i = 0; i < tp_cfg.w_size; i++) {
                     tp_cfg.sub_memory->_memorys_table[tp_cfg.id][i].flag = false;
+                    tp_cfg.sub_memory->_ready_rows[tp_cfg.id][i].store(0);
                 }
             }
             if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == 0) {
@@ -412,9 +417,101 @@ void FullyConnected::execTensorParallelSync() {
     }
 }
 
+void FullyConnected::prepareTensorParallelChunks() {
+    tp_cfg.chunks = {};
+    if (!tp_cfg.enable_tensor_parallel || tp_cfg.chunk_rows == 0 ||
+        !memory[ARG_SRC]->getDesc().hasLayoutType(LayoutType::ncsp)) {
+        return;
+    }
+    // the decision depends only on the full source shape, so all the sub-streams make the same one
+    tp_cfg.chunks = TensorParallelChunks::create(memory[ARG_SRC]->getStaticDims(), tp_cfg.chunk_rows);
+    if (tp_cfg.chunks.empty()) {
+        return;
+    }
+    prepareTensorParallelChunk(tp_cfg.full_chunk, tp_cfg.chunks.chunkUnits);
+    if (tp_cfg.chunks.tailUnits() != 0) {
+        prepareTensorParallelChunk(tp_cfg.tail_chunk, tp_cfg.chunks.tailUnits());
+    }
+}
+
+void FullyConnected::prepareTensorParallelChunk(FCTensorParallelChunk& chunk, size_t units) {
+    const auto& src = memory[ARG_SRC];
+    const auto& cur_dst = memory[ARG_DST];
+    auto srcDims = src->getStaticDims();
+    srcDims[tp_cfg.chunks.dim] = units;
+    auto dstDims = cur_dst->getStaticDims();
+    dstDims[tp_cfg.chunks.dim] = units;
+
+    // the chunk memory is bound to the data of the chunk at the execution
+    chunk.memory = memory;
+    chunk.memory[ARG_SRC] =
+        std::make_shared<Memory>(getEngine(), src->getDescPtr()->cloneWithNewDims(srcDims), src->getData());
+    chunk.memory[ARG_DST] =
+        std::make_shared<Memory>(getEngine(), cur_dst->getDescPtr()->cloneWithNewDims(dstDims), cur_dst->getData());
+    if (chunk.executor) {
+        chunk.executor->update(chunk.memory);
+    } else {
+        chunk.executor = factory->make(chunk.memory);
+    }
+}
+
+void FullyConnected::execTensorParallelChunks() {
+    const auto& cpu_parallel = context->getCpuParallel();
+    const auto& chunks = tp_cfg.chunks;
+    const auto& src = memory[ARG_SRC];
+    const auto& cur_dst = memory[ARG_DST];
+    auto dst = getDstMemoryAtPort(0);
+
+    const auto& srcDims = src->getStaticDims();
+    const auto& curDstDims = cur_dst->getStaticDims();
+    const auto& dims = dst->getStaticDims();
+    const auto prec = dst->getPrecision();
+
+    auto split_parts = [](int len, int n) {
+        int average = len / n;
+        std::vector<int> parts(n, average);
+        parts.back() = len - average * (n - 1);
+        return parts;
+    };
+
+    const auto srcUnitSize = chunks.unitRows * srcDims.back() * src->getPrecision().size();
+    const auto curDstUnitSize = chunks.unitRows * curDstDims.back() * prec.size();
+
+    auto& memorys = tp_cfg.sub_memory->_memorys_table[tp_cfg.id];
+    auto& readyRows = tp_cfg.sub_memory->_ready_rows[tp_cfg.id];
+    memorys[tp_cfg.w_rank].send_buf = cur_dst->getData();
+
+    TensorParallelGather gather(chunks.rows(), split_parts(dims.back(), tp_cfg.w_size), prec.size());
+    for (size_t unit = 0; unit < chunks.units; unit += chunks.chunkUnits) {
+        auto& chunk = unit + chunks.chunkUnits <= chunks.units ? tp_cfg.full_chunk : tp_cfg.tail_chunk;
+        const auto& srcChunk = chunk.memory[ARG_SRC];
+        const auto& dstChunk = chunk.memory[ARG_DST];
+        srcChunk->getMemoryBlock()->setExtBuff(src->getDataAs<uint8_t>() + unit * srcUnitSize, srcChunk->getSize());
+        dstChunk->getMemoryBlock()->setExtBuff(cur_dst->getDataAs<uint8_t>() + unit * curDstUnitSize,
+                                               dstChunk->getSize());
+        chunk.executor->execute(chunk.memory);
+        readyRows[tp_cfg.w_rank].store(std::min(unit + chunks.chunkUnits, chunks.units) * chunks.unitRows,
+                                       std::memory_order_release);
+        // the chunks of the other sub-streams are copied while they compute the next ones
+        gather.gather(dst->getDataAs<uint8_t>(), memorys, readyRows, *cpu_parallel);
+    }
+    while (!gather.gather(dst->getDataAs<uint8_t>(), memorys, readyRows, *cpu_parallel)) {
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
+        tp_cfg.sub_memory->_use_count[tp_cfg.id]++;
+    }
+}
+
 void FullyConnected::execute([[maybe_unused]] const dnnl::stream& strm) {
     initTensorParallelSync();
 
+    if (!tp_cfg.chunks.empty()) {
+        execTensorParallelChunks();
+        return;
+    }
+
     executor->execute(memory);
 
     execTensorParallelSync();
@@ -561,10 +658,60 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
     return sparseRate >= minSparseRate;
 }
 
+static bool useStructuredSparseWeights(const NodePtr& weightsInput,
+                                       const ov::element::Type inputType,
+                                       const bool weightsNonTransposed) {
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
+    if (!constNode || inputType != f32) {
+        return false;
+    }
+
+    const auto weiMemory = constNode->getMemoryPtr();
+    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
+
+    const auto& weiDims = weiMemory->getShape().getStaticDims();
+    if (weiDims.size() != 2 || weiMemory->getPrecision() != f32) {
+        return false;
+    }
+
+    const size_t N = weightsNonTransposed ? weiDims[1] : weiDims[0];
+    const size_t K = weightsNonTransposed ? weiDims[0] : weiDims[1];
+    if (K % 4 != 0 || K == 0 || N == 0) {
+        return false;
+    }
+
+    // each group of 4 consecutive input channels of each output channel has at most 2 nonzero values
+    const auto* const weightsData = weiMemory->getDataAs<const float>();
+    for (size_t n = 0; n < N; n++) {
+        for (size_t k = 0; k < K; k += 4) {
+            size_t nnzCount = 0;
+            for (size_t i = 0; i < 4; i++) {
+                const float value = weightsNonTransposed ? weightsData[(k + i) * N + n] : weightsData[n * K + k + i];
+                nnzCount += value != 0.F ? 1 : 0;
+            }
+            if (nnzCount > 2) {
+                return false;
+            }
+        }
+    }
+
+    DEBUG_LOG("Weights have 2:4 structured sparsity, N = ", N, ", K = ", K);
+
+    return true;
+}
+
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
+    attrs.structuredSparseWeights = context->getConfig().fcStructuredSparseWeights && !tp_cfg.enable_tensor_parallel &&
+                                    useStructuredSparseWeights(getParentEdgeAt(WEIGHTS)->getParent(),
+                                                               getOriginalInputPrecisionAtPort(DATA),
+                                                               attrs.weightsNonTransposed);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
 
@@ -17,6 +17,7 @@
 #include "config.h"
 #include "cpu_memory.h"
 #include "graph_context.h"
+#include "nodes/common/tensor_parallel_chunks.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/executor_factory.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
@@ -28,12 +29,24 @@
 
 namespace ov::intel_cpu::node {
 
+// the executor prepared for the chunks of the same size and the memory of the chunk it computes
+struct FCTensorParallelChunk {
+    ExecutorPtr executor = nullptr;
+    MemoryArgs memory;
+};
+
 // tensor parallel config
 struct FCTensorParallelConfig {
     int w_rank = -1;
     int w_size = -1;
     int id = 0;
     bool enable_tensor_parallel = false;
+    // the rows of the output computed by a chunk, 0 means the output isn't chunked
+    size_t chunk_rows = 0;
+    // the chunks of the current source, the executors are prepared once the source shape is changed
+    TensorParallelChunks chunks;
+    FCTensorParallelChunk full_chunk;
+    FCTensorParallelChunk tail_chunk;
     std::shared_ptr<SubMemoryManager> sub_memory = nullptr;
     MemoryPtr cached_splited_weight = nullptr;
     MemoryPtr cached_splited_bias = nullptr;
@@ -118,6 +131,9 @@ private:
     void needPrepareParamsForTensorParallel();
     void initTensorParallelSync();
     void execTensorParallelSync();
+    void prepareTensorParallelChunks();
+    void prepareTensorParallelChunk(FCTensorParallelChunk& chunk, size_t units);
+    void execTensorParallelChunks();
     void needSplitMemoryForTensorParallel();
 
     FCAttrs attrs;
@@ -7,13 +7,17 @@
 #include <oneapi/dnnl/dnnl_common_types.h>
 #include <oneapi/dnnl/dnnl_types.h>
 
+#include <algorithm>
 #include <bitset>
 #include <common/primitive_hashing_utils.hpp>
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -241,6 +245,79 @@ private:
     bool m_has_bias = false;
 };
 
+// Keeps a bounded number of the experts weights repacked, the weights of the other experts stay in the source
+// memory, which may be a file-backed (mmapped) constant, and are repacked on demand evicting the least recently used
+// expert
+class GatherMatmul::ExpertsWeightsCache {
+public:
+    ExpertsWeightsCache(const dnnl::engine& eng,
+                        MemoryCPtr source,
+                        MemoryDescPtr expertSourceDesc,
+                        MemoryDescPtr expertPackedDesc,
+                        size_t numExperts,
+                        size_t capacity)
+        : m_eng(eng),
+          m_source(std::move(source)),
+          m_expert_source_desc(std::move(expertSourceDesc)),
+          m_expert_packed_desc(std::move(expertPackedDesc)),
+          m_expert_slot(numExperts, -1),
+          m_slot_expert(capacity),
+          m_slot_last_use(capacity, 0) {
+        const auto& dims = m_expert_source_desc->getShape().getStaticDims();
+        const size_t expert_bits = std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<>()) *
+                                   m_expert_source_desc->getPrecision().bitwidth();
+        OPENVINO_ASSERT(expert_bits % 8 == 0, "Experts weights are not byte aligned");
+        m_expert_source_size = expert_bits / 8;
+        m_expert_packed_size = rnd_up(m_expert_packed_desc->getCurrentMemSize(), 64);  // 64 bytes is the cache line
+        m_slots = std::make_shared<Memory>(
+            m_eng,
+            std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape({capacity * m_expert_packed_size})));
+    }
+
+    void* get(size_t expert) {
+        auto slot = m_expert_slot[expert];
+        if (slot < 0) {
+            slot = static_cast<int64_t>(acquire_slot());
+            auto* source_ptr = static_cast<uint8_t*>(m_source->getData()) + expert * m_expert_source_size;
+            Memory expertSource(m_eng, m_expert_source_desc, source_ptr);
+            Memory expertPacked(m_eng, m_expert_packed_desc, slot_ptr(slot));
+            expertPacked.load(expertSource, false, false);
+            m_expert_slot[expert] = slot;
+            m_slot_expert[slot] = expert;
+        }
+        m_slot_last_use[slot] = ++m_clock;
+        return slot_ptr(slot);
+    }
+
+private:
+    size_t acquire_slot() {
+        if (m_used_slots < m_slot_expert.size()) {
+            return m_used_slots++;
+        }
+        const auto lru = static_cast<size_t>(
+            std::distance(m_slot_last_use.begin(), std::min_element(m_slot_last_use.begin(), m_slot_last_use.end())));
+        m_expert_slot[m_slot_expert[lru]] = -1;
+        return lru;
+    }
+
+    void* slot_ptr(int64_t slot) const {
+        return m_slots->getDataAs<uint8_t>() + static_cast<size_t>(slot) * m_expert_packed_size;
+    }
+
+    dnnl::engine m_eng;
+    MemoryCPtr m_source;
+    MemoryDescPtr m_expert_source_desc;
+    MemoryDescPtr m_expert_packed_desc;
+    size_t m_expert_source_size = 0;
+    size_t m_expert_packed_size = 0;
+    MemoryPtr m_slots;
+    std::vector<int64_t> m_expert_slot;
+    std::vector<size_t> m_slot_expert;
+    std::vector<uint64_t> m_slot_last_use;
+    size_t m_used_slots = 0;
+    uint64_t m_clock = 0;
+};
+
 bool GatherMatmul::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         // Check if the operation is BatchGatherMatmul or BatchGatherMatmulCompressed
@@ -504,10 +581,24 @@ void GatherMatmul::createPrimitive() {
         return MemoryDescUtils::convertToDnnlMemoryDesc(targetDesc);
     };
 
-    auto targetWeightsDesc = addBatchDim(gemvWeightsDesc, weiDims[0]);
+    m_numExperts = weiDims[0];
+    const auto expertsCacheSize = context->getConfig().moeExpertsCacheSize;
+    if (expertsCacheSize != 0 && expertsCacheSize < m_numExperts) {
+        // the experts are repacked lazily, the source weights are kept as is
+        auto expertSourceDesc = std::make_shared<CpuBlockedMemoryDesc>(weightsMemoryDesc->getPrecision(),
+                                                                       Shape(VectorDims{weiDims[1], weiDims[2]}));
+        m_expertsCache = std::make_shared<ExpertsWeightsCache>(getEngine(),
+                                                               getSrcMemoryAtPort(WEIGHTS),
+                                                               expertSourceDesc,
+                                                               gemvWeightsDesc,
+                                                               m_numExperts,
+                                                               expertsCacheSize);
+    } else {
+        auto targetWeightsDesc = addBatchDim(gemvWeightsDesc, m_numExperts);
 
-    m_weightsMemory =
-        prepareWeightMemory(targetWeightsDesc, MemoryDescUtils::convertToDnnlMemoryDesc(weightsMemoryDesc));
+        m_weightsMemory =
+            prepareWeightMemory(targetWeightsDesc, MemoryDescUtils::convertToDnnlMemoryDesc(weightsMemoryDesc));
+    }
 
     if (!scale_shape.empty()) {
         auto expectedScaleMemDesc =
@@ -570,6 +661,19 @@ static Dim normalizeM(Dim M) {
     return M;
 }
 
+static VectorDims getGroupedParamsShape(const MemoryPtr& mem) {
+    VectorDims shape{};
+    if (mem) {
+        const auto& fullDims = mem->getStaticDims();
+        if (1 == fullDims.size()) {
+            shape.push_back(fullDims[0]);
+        } else {
+            shape.assign(fullDims.begin() + 1, fullDims.end());
+        }
+    }
+    return shape;
+}
+
 void GatherMatmul::prepareParams() {
     auto srcMem = getSrcMemoryAtPort(DATA);
     const auto& srcShape = srcMem->getStaticDims();
@@ -588,44 +692,37 @@ void GatherMatmul::prepareParams() {
     const size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
     auto scratchPadDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::u8, Shape({totalSize}));
     m_tmpInpBuffer = getScratchPadMem(scratchPadDesc);
+}
+
+GatherMatmul::GemvImplPtr GatherMatmul::getGemmImpl(Dim M) {
+    auto& impl = m_gemmImpls[M];
+    if (impl) {
+        return impl;
+    }
 
     CPU_NODE_ASSERT(gemv_impl, "GEMV implementation is not created");
+    CPU_NODE_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
 
-    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(srcShape[2])},
-                              DnnlExtensionUtils::ElementTypeToDataType(srcPrc),
+    const auto& tmpInputShape = m_tmpInputDesc->getShape().getStaticDims();
+    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(tmpInputShape[1])},
+                              DnnlExtensionUtils::ElementTypeToDataType(m_tmpInputDesc->getPrecision()),
                               dnnl::memory::format_tag::ab);
+    // the GEMM has to use the weights layout the weights were repacked to for the GEMV
     auto weights_md = gemv_impl->get_weights_md();
 
-    VectorDims scale_shape{};
-    VectorDims zp_shape{};
-
-    if (m_scalesMemory) {
-        const auto& fullScaleDims = m_scalesMemory->getStaticDims();
-        if (1 == fullScaleDims.size()) {
-            scale_shape.push_back(fullScaleDims[0]);
-        } else {
-            scale_shape.assign(fullScaleDims.begin() + 1, fullScaleDims.end());
-        }
-    }
-
-    if (m_zpMemory) {
-        const auto& fullZpDims = m_zpMemory->getStaticDims();
-        if (1 == fullZpDims.size()) {
-            zp_shape.push_back(fullZpDims[0]);
-        } else {
-            zp_shape.assign(fullZpDims.begin() + 1, fullZpDims.end());
-        }
-    }
-
-    auto biasMemory = getSrcMemoryAtPort(BIAS);
-    const auto& biasDesc = biasMemory->getDesc();
-    onednn_matmul_key key{src_md, weights_md, scale_shape, zp_shape, !biasDesc.empty()};
+    const auto& biasDesc = getSrcMemoryAtPort(BIAS)->getDesc();
+    onednn_matmul_key key{src_md,
+                          weights_md,
+                          getGroupedParamsShape(m_scalesMemory),
+                          getGroupedParamsShape(m_zpMemory),
+                          !biasDesc.empty()};
 
     auto cache = context->getParamsCache();
     const auto& eng = getEngine();
-    std::tie(gemm_impl, std::ignore) = cache->getOrCreate(key, [&eng](const onednn_matmul_key& k) {
+    std::tie(impl, std::ignore) = cache->getOrCreate(key, [&eng](const onednn_matmul_key& k) {
         return std::make_shared<onednn_matmul>(eng, k);
     });
+    return impl;
 }
 
 bool GatherMatmul::isExecutable() const {
@@ -718,6 +815,9 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
     auto src_offset = OffsetHelper::createOffsetHelper(srcMem);
     auto dst_offset = OffsetHelper::createOffsetHelper(dstMem);
     auto wei_offset = OffsetHelper::createOffsetHelper(m_weightsMemory);
+    auto expert_weights = [&](size_t gather_axis_index) {
+        return m_expertsCache ? m_expertsCache->get(gather_axis_index) : wei_offset(gather_axis_index);
+    };
     auto bias_offset = OffsetHelper::createOffsetHelper(biasMem);
     auto scale_offset = OffsetHelper::createOffsetHelper(m_scalesMemory);
     auto zp_offset = OffsetHelper::createOffsetHelper(m_zpMemory);
@@ -731,11 +831,10 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
     //    output[b,m,:] = MatMul(A[b,m,:], gathered_weights)
 
     if (M > 1) {
-        const size_t gather_axis_size = m_weightsMemory->getStaticDims()[0];
+        const size_t gather_axis_size = m_numExperts;
 
-        // all the gather idx for corresponding m index
-        std::vector<std::pair<int32_t, int32_t>> gather_idx_map(gather_axis_size * M);
-        std::vector<int32_t> elements_per_gather_indx(gather_axis_size, 0);
+        // group the (m, i) pairs by the gather index with a counting sort, so the rows of each expert are contiguous
+        std::vector<size_t> rows_offsets(gather_axis_size + 1, 0);
         for (size_t m = 0; m < M; m++) {
             const auto* gather_ids = static_cast<const int32_t*>(index_offset(m));
             for (size_t i = 0; i < indices_size; i++) {
@@ -745,9 +844,17 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
                                 gather_axis_index,
                                 " for m ",
                                 m);
-                auto& index = elements_per_gather_indx[gather_axis_index];
-                gather_idx_map[gather_axis_index * M + index] = {m, i};
-                index++;
+                rows_offsets[gather_axis_index + 1]++;
+            }
+        }
+        std::partial_sum(rows_offsets.begin(), rows_offsets.end(), rows_offsets.begin());
+
+        std::vector<std::pair<int32_t, int32_t>> grouped_rows(rows_offsets.back());
+        std::vector<size_t> rows_fill(rows_offsets.begin(), rows_offsets.end() - 1);
+        for (size_t m = 0; m < M; m++) {
+            const auto* gather_ids = static_cast<const int32_t*>(index_offset(m));
+            for (size_t i = 0; i < indices_size; i++) {
+                grouped_rows[rows_fill[gather_ids[i]]++] = {static_cast<int32_t>(m), static_cast<int32_t>(i)};
             }
         }
 
@@ -756,6 +863,9 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
             // first we pack all the tokens corresponding to a specific expert into a temporary buffer
             // then we call GEMM for that expert on that temporary buffer
             // and finally scatter the results to result memory
+            // The GEMM is sized to the number of the expert tokens rather than to the total number of tokens,
+            // so the experts hit by a few tokens don't pay for the padding, and the experts which are not hit
+            // at all are skipped together with the decompression of their weights
             CPU_NODE_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
             CPU_NODE_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
             CPU_NODE_ASSERT(m_tmpOutputDesc, "Temporary output memory desc is not created");
@@ -775,58 +885,64 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
             auto tmp_input_offset = OffsetHelper::createOffsetHelper(tmpInput);
             auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
 
-            CPU_NODE_ASSERT(gemm_impl, "GEMM implementation is not created");
             for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
-                if (0 == num_valid_rows) {
+                if (rows_offsets[gather_axis_index] == rows_offsets[gather_axis_index + 1]) {
                     continue;
                 }
-
-                parallel_for(M_size, [&](size_t m) {
-                    auto* dst_row = tmp_input_offset(m);
-
-                    if (m < num_valid_rows) {
-                        const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                        const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                        const auto* src_data = src_offset(batch_index, row_id);
-                        std::memcpy(dst_row, src_data, K_size * element_size);
-                    } else {
-                        // Zero padding for rows beyond num_valid_tokens
-                        std::memset(dst_row, 0, K_size * element_size);
-                    }
-                });
-
-                auto* src = tmp_input_offset.get_base();
-                auto* dst = tmp_dst_offset.get_base();
-                auto* wei = wei_offset(gather_axis_index);
+                auto* wei = expert_weights(gather_axis_index);
                 auto* bias = bias_offset(gather_axis_index);
                 auto* scale = scale_offset(gather_axis_index);
                 auto* zp = zp_offset(gather_axis_index);
-                gemm_impl->exec(strm, src, dst, wei, bias, scale, zp);
-
-                // Immediately scatter results while they're hot in cache
-                parallel_for(num_valid_rows, [&](size_t m) {
-                    const auto* src_row = tmp_dst_offset(m);
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* dst_row = dst_offset(batch_index, row_id);
-                    std::memcpy(dst_row, src_row, N_size * element_size);
-                });
+
+                // the temporary buffer fits M_size rows, an expert can be hit more times if the indices repeat
+                for (size_t tile_begin = rows_offsets[gather_axis_index];
+                     tile_begin < rows_offsets[gather_axis_index + 1];
+                     tile_begin += M_size) {
+                    const size_t num_valid_rows = std::min(M_size, rows_offsets[gather_axis_index + 1] - tile_begin);
+                    const size_t tile_rows = std::min(M_size, normalizeM(num_valid_rows));
+                    const auto* tile = grouped_rows.data() + tile_begin;
+
+                    parallel_for(tile_rows, [&](size_t m) {
+                        auto* dst_row = tmp_input_offset(m);
+
+                        if (m < num_valid_rows) {
+                            const auto row_id = tile[m].first;
+                            const auto batch_index = tile[m].second;
+                            const auto* src_data = src_offset(batch_index, row_id);
+                            std::memcpy(dst_row, src_data, K_size * element_size);
+                        } else {
+                            // Zero padding for rows beyond num_valid_tokens
+                            std::memset(dst_row, 0, K_size * element_size);
+                        }
+                    });
+
+                    auto gemm_impl = getGemmImpl(tile_rows);
+                    gemm_impl->exec(strm, tmp_input_offset.get_base(), tmp_dst_offset.get_base(), wei, bias, scale, zp);
+
+                    // Immediately scatter results while they're hot in cache
+                    parallel_for(num_valid_rows, [&](size_t m) {
+                        const auto* src_row = tmp_dst_offset(m);
+                        const auto row_id = tile[m].first;
+                        const auto batch_index = tile[m].second;
+                        auto* dst_row = dst_offset(batch_index, row_id);
+                        std::memcpy(dst_row, src_row, N_size * element_size);
+                    });
+                }
             }
         } else {
             // For the default SIMD it's better to simply call GEMV
             CPU_NODE_ASSERT(gemv_impl, "GEMM implementation is not created");
             for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                if (0 == elements_per_gather_indx[gather_axis_index]) {
+                if (rows_offsets[gather_axis_index] == rows_offsets[gather_axis_index + 1]) {
                     continue;
                 }
-                auto* wei = wei_offset(gather_axis_index);
+                auto* wei = expert_weights(gather_axis_index);
                 auto* bias = bias_offset(gather_axis_index);
                 auto* scale = scale_offset(gather_axis_index);
                 auto* zp = zp_offset(gather_axis_index);
-                for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; ++m) {
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
+                for (size_t r = rows_offsets[gather_axis_index]; r < rows_offsets[gather_axis_index + 1]; ++r) {
+                    const auto row_id = grouped_rows[r].first;
+                    const auto batch_index = grouped_rows[r].second;
                     auto* src = src_offset(batch_index, row_id);
                     auto* dst = dst_offset(batch_index, row_id);
                     gemv_impl->exec(strm, src, dst, wei, bias, scale, zp);
@@ -842,7 +958,7 @@ void GatherMatmul::execute(const dnnl::stream& strm) {
             int32_t gather_axis_index = gather_ids[i];
             auto* src = src_offset(i, m);
             auto* dst = dst_offset(i, m);
-            auto* wei = wei_offset(gather_axis_index);
+            auto* wei = expert_weights(gather_axis_index);
             auto* bias = bias_offset(gather_axis_index);
             auto* scale = scale_offset(gather_axis_index);
             auto* zp = zp_offset(gather_axis_index);
@@ -7,8 +7,10 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <string>
+#include <unordered_map>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
 #include "nodes/executors/memory_arguments.hpp"
@@ -55,15 +57,22 @@ private:
     };
 
     class onednn_matmul;
+    class ExpertsWeightsCache;
 
     using GemvImplPtr = std::shared_ptr<onednn_matmul>;
 
     Algorithm algorithm = Algorithm::GatherMatmulDefault;
     MemoryArgs memory;
+    GemvImplPtr getGemmImpl(Dim M);
+
     GemvImplPtr gemv_impl = nullptr;
-    GemvImplPtr gemm_impl = nullptr;
+    // GEMM implementations for the experts tiles, by the number of the tile rows
+    std::unordered_map<Dim, GemvImplPtr> m_gemmImpls;
 
+    size_t m_numExperts = 0;
     MemoryPtr m_weightsMemory = nullptr;
+    // not null if the experts weights are repacked on demand, see ov::intel_cpu::moe_experts_cache_size
+    std::shared_ptr<ExpertsWeightsCache> m_expertsCache = nullptr;
     MemoryPtr m_scalesMemory = nullptr;
     MemoryPtr m_zpMemory = nullptr;
 
@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+// rows of the source processed together, the loaded weights are reused for all of them
+constexpr size_t rows_block = 4;
+
+#if defined(HAVE_AVX512F)
+template <size_t ROWS>
+void sparse_fc_2_4_rows(const float* src,
+                        size_t src_stride,
+                        size_t K,
+                        const float* values,
+                        const uint8_t* indices,
+                        const float* bias,
+                        float* dst,
+                        size_t dst_stride,
+                        size_t oc_count) {
+    const __mmask16 mask = oc_count == sparse_fc_oc_block ? 0xFFFF : ((1U << oc_count) - 1);
+    __m512 acc[ROWS];
+    for (size_t r = 0; r < ROWS; r++) {
+        acc[r] = bias ? _mm512_maskz_loadu_ps(mask, bias) : _mm512_setzero_ps();
+    }
+    for (size_t k = 0; k < K; k += 4, values += 2 * sparse_fc_oc_block, indices += 2 * sparse_fc_oc_block) {
+        const auto w0 = _mm512_loadu_ps(values);
+        const auto w1 = _mm512_loadu_ps(values + sparse_fc_oc_block);
+        const auto i0 = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices)));
+        const auto i1 =
+            _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + sparse_fc_oc_block)));
+        for (size_t r = 0; r < ROWS; r++) {
+            // the group of 4 inputs is repeated in all the lanes, so the positions 0..3 select from it
+            const auto x = _mm512_broadcast_f32x4(_mm_loadu_ps(src + r * src_stride + k));
+            acc[r] = _mm512_fmadd_ps(w0, _mm512_permutexvar_ps(i0, x), acc[r]);
+            acc[r] = _mm512_fmadd_ps(w1, _mm512_permutexvar_ps(i1, x), acc[r]);
+        }
+    }
+    for (size_t r = 0; r < ROWS; r++) {
+        _mm512_mask_storeu_ps(dst + r * dst_stride, mask, acc[r]);
+    }
+}
+#elif defined(HAVE_AVX2)
+template <size_t ROWS>
+void sparse_fc_2_4_rows(const float* src,
+                        size_t src_stride,
+                        size_t K,
+                        const float* values,
+                        const uint8_t* indices,
+                        const float* bias,
+                        float* dst,
+                        size_t dst_stride,
+                        size_t oc_count) {
+    constexpr size_t half = sparse_fc_oc_block / 2;
+    __m256 acc[ROWS][2];
+    for (size_t r = 0; r < ROWS; r++) {
+        for (size_t h = 0; h < 2; h++) {
+            acc[r][h] = _mm256_setzero_ps();
+        }
+    }
+    for (size_t k = 0; k < K; k += 4, values += 2 * sparse_fc_oc_block, indices += 2 * sparse_fc_oc_block) {
+        __m256 w[2][2];
+        __m256i idx[2][2];
+        for (size_t s = 0; s < 2; s++) {
+            for (size_t h = 0; h < 2; h++) {
+                const size_t offset = s * sparse_fc_oc_block + h * half;
+                w[s][h] = _mm256_loadu_ps(values + offset);
+                idx[s][h] = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices + offset)));
+            }
+        }
+        for (size_t r = 0; r < ROWS; r++) {
+            // the group of 4 inputs is repeated in both the halves, so the positions 0..3 select from it
+            const auto x = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(src + r * src_stride + k));
+            for (size_t h = 0; h < 2; h++) {
+                acc[r][h] = _mm256_fmadd_ps(w[0][h], _mm256_permutevar8x32_ps(x, idx[0][h]), acc[r][h]);
+                acc[r][h] = _mm256_fmadd_ps(w[1][h], _mm256_permutevar8x32_ps(x, idx[1][h]), acc[r][h]);
+            }
+        }
+    }
+    float out[sparse_fc_oc_block];
+    for (size_t r = 0; r < ROWS; r++) {
+        _mm256_storeu_ps(out, acc[r][0]);
+        _mm256_storeu_ps(out + half, acc[r][1]);
+        for (size_t oc = 0; oc < oc_count; oc++) {
+            dst[r * dst_stride + oc] = out[oc] + (bias ? bias[oc] : 0.F);
+        }
+    }
+}
+#else
+template <size_t ROWS>
+void sparse_fc_2_4_rows(const float* src,
+                        size_t src_stride,
+                        size_t K,
+                        const float* values,
+                        const uint8_t* indices,
+                        const float* bias,
+                        float* dst,
+                        size_t dst_stride,
+                        size_t oc_count) {
+    float acc[ROWS][sparse_fc_oc_block] = {};
+    for (size_t k = 0; k < K; k += 4, values += 2 * sparse_fc_oc_block, indices += 2 * sparse_fc_oc_block) {
+        for (size_t r = 0; r < ROWS; r++) {
+            const float* x = src + r * src_stride + k;
+            for (size_t oc = 0; oc < sparse_fc_oc_block; oc++) {
+                acc[r][oc] += values[oc] * x[indices[oc]] +
+                              values[sparse_fc_oc_block + oc] * x[indices[sparse_fc_oc_block + oc]];
+            }
+        }
+    }
+    for (size_t r = 0; r < ROWS; r++) {
+        for (size_t oc = 0; oc < oc_count; oc++) {
+            dst[r * dst_stride + oc] = acc[r][oc] + (bias ? bias[oc] : 0.F);
+        }
+    }
+}
+#endif
+
+}  // namespace
+
+void sparse_fc_2_4(const float* src,
+                   size_t src_stride,
+                   size_t M,
+                   size_t K,
+                   const float* values,
+                   const uint8_t* indices,
+                   const float* bias,
+                   float* dst,
+                   size_t dst_stride,
+                   size_t oc_count) {
+    size_t m = 0;
+    for (; m + rows_block <= M; m += rows_block) {
+        sparse_fc_2_4_rows<rows_block>(src + m * src_stride,
+                                       src_stride,
+                                       K,
+                                       values,
+                                       indices,
+                                       bias,
+                                       dst + m * dst_stride,
+                                       dst_stride,
+                                       oc_count);
+    }
+    switch (M - m) {
+    case 3:
+        sparse_fc_2_4_rows<3>(src + m * src_stride,
+                              src_stride,
+                              K,
+                              values,
+                              indices,
+                              bias,
+                              dst + m * dst_stride,
+                              dst_stride,
+                              oc_count);
+        break;
+    case 2:
+        sparse_fc_2_4_rows<2>(src + m * src_stride,
+                              src_stride,
+                              K,
+                              values,
+                              indices,
+                              bias,
+                              dst + m * dst_stride,
+                              dst_stride,
+                              oc_count);
+        break;
+    case 1:
+        sparse_fc_2_4_rows<1>(src + m * src_stride,
+                              src_stride,
+                              K,
+                              values,
+                              indices,
+                              bias,
+                              dst + m * dst_stride,
+                              dst_stride,
+                              oc_count);
+        break;
+    default:
+        break;
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
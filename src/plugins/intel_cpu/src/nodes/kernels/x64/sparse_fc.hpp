@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::Extensions::Cpu::XARCH {
+
+// Output channels packed together by the 2:4 sparse weights layout
+constexpr size_t sparse_fc_oc_block = 16;
+
+/**
+ * Computes a block of sparse_fc_oc_block output channels of the FullyConnected with 2:4 structured sparse weights.
+ * For each group of 4 input channels the packed weights keep 2 values per output channel and their positions in the
+ * group (0..3), the slots of the output channels are interleaved: values[K / 4][2][sparse_fc_oc_block],
+ * indices[K / 4][2][sparse_fc_oc_block].
+ * @param oc_count the number of the valid output channels of the block, the others are not stored
+ */
+void sparse_fc_2_4(const float* src,
+                   size_t src_stride,
+                   size_t M,
+                   size_t K,
+                   const float* values,
+                   const uint8_t* indices,
+                   const float* bias,
+                   float* dst,
+                   size_t dst_stride,
+                   size_t oc_count);
+
+}  // namespace ov::Extensions::Cpu::XARCH
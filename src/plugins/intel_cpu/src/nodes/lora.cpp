@@ -4,13 +4,18 @@
 
 #include "lora.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "common/cpu_memcpy.h"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "node.h"
@@ -20,10 +25,22 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 #include "utils/debug_capabilities.h"
 
+#if defined(OV_CPU_WITH_MLAS)
+#    include "mlas/sgemm.hpp"
+#endif
+
 namespace ov::intel_cpu::node {
 
 bool LoRA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
@@ -52,6 +69,63 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    m_groupedAdapters = loraModel->get_input_size() == ADAPTER_INDICES + 1 && isGroupedAdaptersBody(m_body);
+}
+
+bool LoRA::isGroupedAdaptersBody(const std::shared_ptr<const ov::Model>& body) {
+    // out = main_flow + ((lora_input x Gather(A)^T) * Gather(alpha)) x Gather(B)^T
+    const auto& params = body->get_parameters();
+    if (params.size() != ADAPTER_INDICES + 1 || body->get_results().size() != 1) {
+        return false;
+    }
+    auto isParameter = [&params](const ov::Output<ov::Node>& output, size_t idx) {
+        return output.get_node() == params[idx].get();
+    };
+    // the matrix gathered from the adapters bank by the adapter indices along the outermost dimension
+    auto isBankGather = [&](const ov::Output<ov::Node>& output, size_t bankIdx) {
+        const auto gather = ov::as_type<const ov::op::v8::Gather>(output.get_node());
+        if (!gather || gather->get_batch_dims() != 0 || !isParameter(gather->input_value(0), bankIdx) ||
+            !isParameter(gather->input_value(1), ADAPTER_INDICES)) {
+            return false;
+        }
+        const auto axis = ov::as_type<const ov::op::v0::Constant>(gather->get_input_node_ptr(2));
+        return axis && axis->cast_vector<int64_t>() == std::vector<int64_t>{0};
+    };
+    auto asMatMulTransposedB = [](const ov::Output<ov::Node>& output) {
+        const auto matmul = ov::as_type<const ov::op::v0::MatMul>(output.get_node());
+        return matmul && !matmul->get_transpose_a() && matmul->get_transpose_b() ? matmul : nullptr;
+    };
+    // the commutative eltwise returns the input which isn't the expected one, or an empty output
+    auto otherInput = [](const ov::Node* eltwise, const std::function<bool(const ov::Output<ov::Node>&)>& expected) {
+        for (size_t i = 0; i < 2; i++) {
+            if (expected(eltwise->input_value(i))) {
+                return eltwise->input_value(1 - i);
+            }
+        }
+        return ov::Output<ov::Node>();
+    };
+
+    const auto add = ov::as_type<const ov::op::v1::Add>(body->get_results()[0]->get_input_node_ptr(0));
+    if (!add) {
+        return false;
+    }
+    const auto loraFlow = otherInput(add, [&](const ov::Output<ov::Node>& output) {
+        return isParameter(output, MAIN_FLOW);
+    });
+    const auto matmul2 = loraFlow.get_node() ? asMatMulTransposedB(loraFlow) : nullptr;
+    if (!matmul2 || !isBankGather(matmul2->input_value(1), MATRIX_B)) {
+        return false;
+    }
+    const auto multiply = ov::as_type<const ov::op::v1::Multiply>(matmul2->get_input_node_ptr(0));
+    if (!multiply) {
+        return false;
+    }
+    const auto lowRank = otherInput(multiply, [&](const ov::Output<ov::Node>& output) {
+        return isBankGather(output, ALPHA);
+    });
+    const auto matmul1 = lowRank.get_node() ? asMatMulTransposedB(lowRank) : nullptr;
+    return matmul1 && isParameter(matmul1->input_value(0), LORA_INPUT) &&
+           isBankGather(matmul1->input_value(1), MATRIX_A);
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
@@ -68,7 +142,8 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
     graphInputConfig.emplace_back(node::Input::InputConfig{mainInputDesc, isInPlace});
 
     for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
+        const auto prc = i == ADAPTER_INDICES ? ov::element::i32 : mainInputPrc;
+        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(prc);
         inConfs.emplace_back(desc);
         graphInputConfig.emplace_back(node::Input::InputConfig{desc, isInPlace});
     }
@@ -94,6 +169,9 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
 
     const NodeConfig config(inConfs, outConfs);
 
+    // the grouped low-rank GEMM is implemented for f32 only, otherwise the subgraph is executed
+    m_groupedAdapters = m_groupedAdapters && mainInputPrc == ov::element::f32;
+
     supportedPrimitiveDescriptors.clear();
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::undef);
 
@@ -142,9 +220,159 @@ void LoRA::createPrimitive() {
 }
 
 void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_groupedAdapters && executeGroupedAdapters()) {
+        return;
+    }
     m_graph.Infer();
 }
 
+bool LoRA::executeGroupedAdapters() {
+#if defined(OV_CPU_WITH_MLAS)
+    const auto& xDims = getSrcMemoryAtPort(LORA_INPUT)->getStaticDims();
+    const auto& aDims = getSrcMemoryAtPort(MATRIX_A)->getStaticDims();
+    const auto& alphaDims = getSrcMemoryAtPort(ALPHA)->getStaticDims();
+    const auto& bDims = getSrcMemoryAtPort(MATRIX_B)->getStaticDims();
+    const auto& indicesDims = getSrcMemoryAtPort(ADAPTER_INDICES)->getStaticDims();
+    // the input is [batch, tokens, K] and the banks are [adapters, rank, K], [adapters, 1, rank] and
+    // [adapters, N, rank], the other layouts are left to the subgraph
+    if (xDims.size() != 3 || aDims.size() != 3 || alphaDims.size() != 3 || bDims.size() != 3 ||
+        indicesDims.size() != 1) {
+        return false;
+    }
+    const size_t batch = xDims[0];
+    const size_t tokens = xDims[1];
+    const size_t K = xDims[2];
+    const size_t adapters = aDims[0];
+    const size_t rank = aDims[1];
+    const size_t N = bDims[1];
+    if (indicesDims[0] != batch || aDims[2] != K || alphaDims[0] != adapters || alphaDims[1] != 1 ||
+        alphaDims[2] != rank || bDims[0] != adapters || bDims[2] != rank ||
+        getDstMemoryAtPort(0)->getStaticDims() != VectorDims{batch, tokens, N}) {
+        return false;
+    }
+
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(ADAPTER_INDICES);
+    m_rowsAdapter.resize(batch);
+    for (size_t row = 0; row < batch; row++) {
+        const int64_t index = indices[row] < 0 ? indices[row] + static_cast<int64_t>(adapters) : indices[row];
+        // as for the Gather, the rows with the out of range index get the zero matrices, i.e. no adapter
+        m_rowsAdapter[row] =
+            index >= 0 && static_cast<size_t>(index) < adapters ? static_cast<size_t>(index) : adapters;
+    }
+    // group the rows by the adapter, so a single GEMM applies the adapter to all its rows
+    m_rowsOrder.resize(batch);
+    std::iota(m_rowsOrder.begin(), m_rowsOrder.end(), 0);
+    std::stable_sort(m_rowsOrder.begin(), m_rowsOrder.end(), [&](size_t lhs, size_t rhs) {
+        return m_rowsAdapter[lhs] < m_rowsAdapter[rhs];
+    });
+
+    const auto* mainFlow = getSrcDataAtPortAs<const float>(MAIN_FLOW);
+    auto* dst = getDstDataAtPortAs<float>(0);
+    if (dst != mainFlow) {
+        cpu_parallel_memcpy(dst, mainFlow, batch * tokens * N * sizeof(float));
+    }
+    if (rank == 0 || K == 0) {
+        return true;
+    }
+
+    const auto* x = getSrcDataAtPortAs<const float>(LORA_INPUT);
+    const auto* aBank = getSrcDataAtPortAs<const float>(MATRIX_A);
+    const auto* alphaBank = getSrcDataAtPortAs<const float>(ALPHA);
+    const auto* bBank = getSrcDataAtPortAs<const float>(MATRIX_B);
+    const auto& cpu_parallel = context->getCpuParallel();
+
+    for (size_t first = 0; first < batch;) {
+        const size_t adapter = m_rowsAdapter[m_rowsOrder[first]];
+        size_t last = first + 1;
+        while (last < batch && m_rowsAdapter[m_rowsOrder[last]] == adapter) {
+            last++;
+        }
+        if (adapter == adapters) {
+            break;
+        }
+        const size_t M = (last - first) * tokens;
+        // the stable sort keeps the order of the rows, so the consecutive rows of the group are contiguous
+        // in the input and the output, otherwise they are gathered
+        const bool contiguous = m_rowsOrder[last - 1] - m_rowsOrder[first] == last - first - 1;
+        const float* groupX = x + m_rowsOrder[first] * tokens * K;
+        if (!contiguous) {
+            m_groupInput.resize(M * K);
+            cpu_parallel->parallel_for(last - first, [&](size_t i) {
+                cpu_memcpy(m_groupInput.data() + i * tokens * K,
+                           x + m_rowsOrder[first + i] * tokens * K,
+                           tokens * K * sizeof(float));
+            });
+            groupX = m_groupInput.data();
+        }
+
+        const float* alpha = alphaBank + adapter * rank;
+        m_lowRank.resize(M * rank);
+        mlas_sgemm("N",
+                   "T",
+                   M,
+                   rank,
+                   K,
+                   1.0F,
+                   groupX,
+                   K,
+                   aBank + adapter * rank * K,
+                   K,
+                   0.0F,
+                   m_lowRank.data(),
+                   rank);
+        cpu_parallel->parallel_for(M, [&](size_t m) {
+            for (size_t r = 0; r < rank; r++) {
+                m_lowRank[m * rank + r] *= alpha[r];
+            }
+        });
+
+        const float* b = bBank + adapter * N * rank;
+        if (contiguous) {
+            // accumulate to the main flow copied to the output
+            mlas_sgemm("N",
+                       "T",
+                       M,
+                       N,
+                       rank,
+                       1.0F,
+                       m_lowRank.data(),
+                       rank,
+                       b,
+                       rank,
+                       1.0F,
+                       dst + m_rowsOrder[first] * tokens * N,
+                       N);
+        } else {
+            m_groupOutput.resize(M * N);
+            mlas_sgemm("N",
+                       "T",
+                       M,
+                       N,
+                       rank,
+                       1.0F,
+                       m_lowRank.data(),
+                       rank,
+                       b,
+                       rank,
+                       0.0F,
+                       m_groupOutput.data(),
+                       N);
+            cpu_parallel->parallel_for(last - first, [&](size_t i) {
+                float* dstRows = dst + m_rowsOrder[first + i] * tokens * N;
+                const float* groupRows = m_groupOutput.data() + i * tokens * N;
+                for (size_t j = 0; j < tokens * N; j++) {
+                    dstRows[j] += groupRows[j];
+                }
+            });
+        }
+        first = last;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 void LoRA::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
@@ -39,9 +39,27 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    static constexpr size_t MAIN_FLOW = 0;
+    static constexpr size_t LORA_INPUT = 1;
+    static constexpr size_t MATRIX_A = 2;
+    static constexpr size_t ALPHA = 3;
+    static constexpr size_t MATRIX_B = 4;
+    static constexpr size_t ADAPTER_INDICES = 5;
+
+    static bool isGroupedAdaptersBody(const std::shared_ptr<const ov::Model>& body);
+    bool executeGroupedAdapters();
+
     std::shared_ptr<const ov::Model> m_body;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
+    // the LoRA matrices are banks of several adapters, which are selected per batch row by the adapter indices,
+    // and the subgraph can be replaced with the low-rank GEMMs of the rows grouped by the adapter
+    bool m_groupedAdapters = false;
+    std::vector<size_t> m_rowsOrder;
+    std::vector<size_t> m_rowsAdapter;
+    std::vector<float> m_groupInput;
+    std::vector<float> m_lowRank;
+    std::vector<float> m_groupOutput;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -57,6 +57,8 @@
 #endif
 
 #include <algorithm>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -985,7 +987,8 @@ struct MHASingleToken {
 template <ScaledDotProductAttention::KernelTypes KType, typename T>
 struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAttention::Executor {
     GraphContext::CPtr context;
-    PlainTensor attn_buf;  // f32[[B|1],[H|1], L1|1, L0+L1]
+    PlainTensor attn_buf;          // f32[[B|1],[H|1], L1|1, L0+L1]
+    PlainTensor attn_compact_buf;  // [[B|1],[H|1], L1|1, L0+L1] mask of the evicted KV cache
 
     MHAKernel<KType, T> kernel;
     MHASingleToken kernel_single_token;
@@ -1010,6 +1013,28 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
         }
     }
 
+    // The KV cache evicted by the sliding window holds the sink tokens and the most recent tokens of the session, so
+    // only the mask columns of these tokens are kept.
+    void compact_attn_mask(const PlainTensor& attn_input, size_t sink_tokens, size_t kv_len) {
+        OPENVINO_ASSERT(attn_input.is_dense(), "expects a dense attention mask");
+        auto dims = attn_input.shape();
+        const size_t mask_len = dims.back();
+        const size_t rows = std::accumulate(dims.begin(), dims.end() - 1, size_t{1}, std::multiplies<>());
+        const size_t elem_size = attn_input.m_element_size;
+        dims.back() = kv_len;
+        attn_compact_buf.resize(dims, elem_size, attn_input.m_dt);
+        const auto* src = static_cast<const uint8_t*>(attn_input.ptr_v());
+        auto* dst = static_cast<uint8_t*>(attn_compact_buf.ptr_v());
+        const size_t sinks = std::min(sink_tokens, kv_len);
+        const size_t recent = kv_len - sinks;
+        for (size_t row = 0; row < rows; row++) {
+            const auto* src_row = src + row * mask_len * elem_size;
+            auto* dst_row = dst + row * kv_len * elem_size;
+            std::memcpy(dst_row, src_row, sinks * elem_size);
+            std::memcpy(dst_row + sinks * elem_size, src_row + (mask_len - recent) * elem_size, recent * elem_size);
+        }
+    }
+
     void execute(const dnnl::stream& strm,
                  const Config& config,
                  const std::vector<MemoryPtr>& inputs,
@@ -1100,6 +1125,11 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             sink_input.reset(inputs[5]);
         }
 
+        if (fuse_concat && attn_mask && attn_mask.size(-1) > L0 + L1) {
+            compact_attn_mask(attn_mask, config.sink_tokens, L0 + L1);
+            attn_mask = attn_compact_buf;
+        }
+
         if (fuse_concat) {
             k_input.assert_dims({B, Hk, L1, S});
             v_input.assert_dims({B, Hk, L1, SV});
@@ -1185,7 +1215,7 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 
 ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::Node>& op,
                                                      const GraphContext::CPtr& context)
-    : Node(op, context, SDPAShapeInferFactory(op)) {
+    : Node(op, context, SDPAShapeInferFactory(op, context->getConfig().kvCacheWindowSize != 0)) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
@@ -1217,6 +1247,9 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     } else if (const auto node = ov::as_type_ptr<const SDPAWithTransposeReshape>(op)) {
         m_config.config = node->get_config();
     }
+    if (m_config.config.fuse_concat && cpuConfig.kvCacheWindowSize != 0) {
+        m_config.sink_tokens = cpuConfig.kvCacheSinkTokens;
+    }
 }
 
 void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
@@ -1326,6 +1359,9 @@ void ScaledDotProductAttention::createPrimitive() {
     OPENVINO_ASSERT(valueS % m_value_quant_param.groupSize == 0,
                     "ScaledDotProductAttention AttentionExecutor creation fails value state " + std::to_string(keyS) +
                         " cannot be divided by group size " + std::to_string(m_key_quant_param.groupSize));
+    // the scales of the by-channel quantization are shared by the groups of tokens, which can't be evicted separately
+    CPU_NODE_ASSERT(!m_config.config.fuse_concat || cpuConfig.kvCacheWindowSize == 0 || !m_key_quant_param.isByChannel,
+                    "doesn't support the KV cache sliding window with the by-channel key cache quantization");
     ScaledDotProductAttentionKey key = {rtPrecision};
 
     auto builder = [&]([[maybe_unused]] const ScaledDotProductAttentionKey& key) -> std::shared_ptr<Executor> {
@@ -1432,6 +1468,10 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     }
     m_executor
         ->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp);
+
+    if (m_config.config.fuse_concat && context->getConfig().kvCacheWindowSize != 0) {
+        evictKVCache();
+    }
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
@@ -1572,13 +1612,13 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                                  Shape(shape),
                                                                  permute_axes(shape, real_order),
                                                                  real_order);
-        auto new_internal_mem_k = std::make_shared<Memory>(getEngine(), mem_desc_k);
+        auto new_internal_mem_k = createKVCacheMemory(mem_desc_k);
         shape = reverse({B, H, (L0 + L1) * 2, SV});
         auto mem_desc_v = std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
                                                                  Shape(shape),
                                                                  permute_axes(shape, real_order),
                                                                  real_order);
-        auto new_internal_mem_v = std::make_shared<Memory>(getEngine(), mem_desc_v);
+        auto new_internal_mem_v = createKVCacheMemory(mem_desc_v);
 
         PlainTensor new_pastk;
         PlainTensor new_pastv;
@@ -1959,7 +1999,8 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     // resize buffer
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
     bool need_redefine = true;
-    if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size()) {
+    const bool reallocate = B * H * (L0 + L1) * S > m_k_state->internal_state_max_size();
+    if (reallocate) {
         // new_shape is the shape used by the original model which maybe different from BHLS, reverse here is to permute
         // BHLS to original model shape. BHLS is the stated input shape of SDPA, however internally we use LBHS for
         // KV-cache storage. real_order is used to permute the original shape to LBHS
@@ -1968,7 +2009,7 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             auto real_shape = permute_axes(new_shape, real_order);
             auto mem_desc =
                 std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision, Shape(new_shape), real_shape, real_order);
-            return std::make_shared<Memory>(getEngine(), mem_desc);
+            return createKVCacheMemory(mem_desc);
         };
 
         auto new_internal_mem_k = new_memory(S);
@@ -2165,6 +2206,116 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     } else {
         attn_memcpy(cur_k, cur_v, past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1));
     }
+
+    const auto hotWindow = context->getConfig().kvCacheHotWindow;
+    if (hotWindow != 0 && L0 + L1 > hotWindow) {
+        // the tokens which have left the hot window in this step, or all the cold tokens if the cache is rewritten
+        const size_t coldEnd = L0 + L1 - hotWindow;
+        const size_t coldBegin = (reallocate || is_reset || L0 < hotWindow) ? 0 : L0 - hotWindow;
+        markColdKVCache(internal_mem_k, coldBegin, coldEnd);
+        markColdKVCache(internal_mem_v, coldBegin, coldEnd);
+    }
+}
+
+MemoryPtr ScaledDotProductAttention::createKVCacheMemory(const MemoryDescPtr& desc) const {
+    const auto& spillDir = context->getConfig().kvCacheSpillDir;
+    if (spillDir.empty()) {
+        return std::make_shared<Memory>(getEngine(), desc);
+    }
+    return std::make_shared<Memory>(getEngine(), desc, std::make_shared<FileBackedMemoryBlock>(spillDir));
+}
+
+void ScaledDotProductAttention::markColdKVCache(const MemoryPtr& mem, size_t begin, size_t end) const {
+    auto block = std::dynamic_pointer_cast<FileBackedMemoryBlock>(mem->getMemoryBlock());
+    if (!block || begin >= end) {
+        return;
+    }
+    // LBHS layout, the tokens are the outermost dimension
+    const auto tokenBytes =
+        mem->getDescWithType<BlockedMemoryDesc>()->getStrides()[0] * mem->getPrecision().bitwidth() / 8;
+    block->markCold(begin * tokenBytes, (end - begin) * tokenBytes);
+}
+
+// Sliding window eviction of the KV cache, once the cache exceeds the sink tokens and the window by a chunk of tokens,
+// the window of the most recent tokens is moved in place right after the sink tokens. The chunk amortizes the move
+// over the chunk of the generated tokens, so the cache length stays bounded by sinks + window + chunk.
+void ScaledDotProductAttention::evictKVCache() {
+    const auto& cpuConfig = context->getConfig();
+    const size_t window = cpuConfig.kvCacheWindowSize;
+    const size_t sinks = cpuConfig.kvCacheSinkTokens;
+    const size_t chunk = std::max<size_t>(window / 8, 1);
+    std::vector<size_t> order = {0, 1, 2, 3};
+    if (!m_config.config.permute_axes.empty()) {
+        order = m_config.config.permute_axes;
+    }
+    std::vector<size_t> real_order = {order[2], order[0], order[1], order[3]};
+    auto internal_mem_k = m_k_state->internal_state_mem();
+    auto internal_mem_v = m_v_state->internal_state_mem();
+    const size_t L = internal_mem_k->getStaticDims()[order[2]];
+    if (L < sinks + window + chunk) {
+        return;
+    }
+
+    // the tokens [sinks, L - window) are evicted, the tokens are the outermost dimension of the LBHS layout
+    const size_t first_kept = L - window;
+    const auto& cpu_parallel = context->getCpuParallel();
+    auto move_tokens = [&](uint8_t* base, size_t token_bytes) {
+        auto* dst = base + sinks * token_bytes;
+        const auto* src = base + first_kept * token_bytes;
+        if (first_kept >= sinks + window) {
+            cpu_parallel->parallel_for(window, [&](size_t l) {
+                std::memcpy(dst + l * token_bytes, src + l * token_bytes, token_bytes);
+            });
+        } else {
+            std::memmove(dst, src, window * token_bytes);
+        }
+    };
+    auto token_bytes = [](const MemoryPtr& mem) {
+        return mem->getDescWithType<BlockedMemoryDesc>()->getStrides()[0] * mem->getPrecision().bitwidth() / 8;
+    };
+    move_tokens(internal_mem_k->getDataAs<uint8_t>(), token_bytes(internal_mem_k));
+    move_tokens(internal_mem_v->getDataAs<uint8_t>(), token_bytes(internal_mem_v));
+    if (internal_mem_k->getPrecision() == ov::element::u8) {
+        // by-token scales and zero points, LBHS layout
+        for (auto* scale_zp : {&m_k_state->get_scale_zp(), &m_v_state->get_scale_zp()}) {
+            move_tokens(static_cast<uint8_t*>(scale_zp->ptr_v()), scale_zp->stride_bytes(0));
+        }
+    }
+
+    const size_t new_L = sinks + window;
+    auto redefine_desc = [&](const MemoryPtr& mem) {
+        auto new_shape = mem->getStaticDims();
+        new_shape[order[2]] = new_L;
+        auto real_shape = permute_axes(new_shape, real_order);
+        const auto& strides = mem->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        mem->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(mem->getPrecision(),
+                                                                 Shape(new_shape),
+                                                                 real_shape,
+                                                                 real_order,
+                                                                 0,
+                                                                 VectorDims{},
+                                                                 strides));
+    };
+    redefine_desc(internal_mem_k);
+    redefine_desc(internal_mem_v);
+
+    // beam table [B, L]
+    for (const auto& hidden_state : {m_k_state->hidden_state_mem(), m_v_state->hidden_state_mem()}) {
+        const auto B = hidden_state->getStaticDims()[0];
+        const auto& strides = hidden_state->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        auto* table = hidden_state->getDataAs<int32_t>();
+        for (size_t b = 0; b < B; b++) {
+            std::memmove(table + b * strides[0] + sinks, table + b * strides[0] + first_kept, window * sizeof(int32_t));
+        }
+        std::vector<size_t> new_shape{B, new_L};
+        hidden_state->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                          Shape(new_shape),
+                                                                          new_shape,
+                                                                          VectorDims{0, 1},
+                                                                          0,
+                                                                          VectorDims{},
+                                                                          strides));
+    }
 }
 
 ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
@@ -77,11 +77,16 @@ private:
     void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t L1);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
+    MemoryPtr createKVCacheMemory(const MemoryDescPtr& desc) const;
+    void markColdKVCache(const MemoryPtr& mem, size_t begin, size_t end) const;
+    void evictKVCache();
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
 
     struct Config {
         ScaledDotProductAttentionWithKVCache::Config config;
+        // the first tokens kept by the sliding window eviction of the KV cache
+        size_t sink_tokens = 0;
     };
 
     struct Executor {
@@ -466,6 +466,15 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         const bool ht_value = engConfig.enableHyperThreading;
         return static_cast<decltype(ov::hint::enable_hyper_threading)::value_type>(ht_value);
     }
+    if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
+    }
+    if (name == ov::intel_cpu::infer_request_priority) {
+        return engConfig.inferRequestPriority;
+    }
+    if (name == ov::intel_cpu::runtime_trace_path) {
+        return engConfig.runtimeTracePath;
+    }
     if (name == ov::hint::num_requests) {
         return static_cast<decltype(ov::hint::num_requests)::value_type>(engConfig.hintNumRequests);
     }
@@ -574,12 +583,15 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::hint::scheduling_core_type.name()),
                                                    RW_property(ov::hint::model_distribution_policy.name()),
                                                    RW_property(ov::hint::enable_hyper_threading.name()),
+                                                   RW_property(ov::hint::model_priority.name()),
                                                    RW_property(ov::device::id.name()),
                                                    RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                    RW_property(ov::log::level.name()),
                                                    RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
                                                    RW_property(ov::intel_cpu::enable_tensor_parallel.name()),
                                                    RW_property(ov::intel_cpu::tbb_partitioner.name()),
+                                                   RW_property(ov::intel_cpu::infer_request_priority.name()),
+                                                   RW_property(ov::intel_cpu::runtime_trace_path.name()),
                                                    RW_property(ov::hint::dynamic_quantization_group_size.name()),
                                                    RW_property(ov::hint::kv_cache_precision.name()),
                                                    RW_property(ov::key_cache_precision.name()),
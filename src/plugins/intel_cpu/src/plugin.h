@@ -70,6 +70,8 @@ private:
 
     ov::Any get_ro_property(const std::string& name, const ov::AnyMap& options) const;
 
+    // the compiled model recalculates the streams layout when it is changed at runtime
+    friend class CompiledModel;
     static void get_performance_streams(Config& config, const std::shared_ptr<ov::Model>& model);
     static void calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& model, bool imported = false);
     Config engConfig;
@@ -0,0 +1,218 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "request_coalescer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "async_infer_request.h"
+#include "infer_request.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+RequestCoalescer::RequestCoalescer(RequestFactory requestFactory, std::chrono::microseconds timeout, size_t maxBatch)
+    : m_requestFactory(std::move(requestFactory)),
+      m_timeout(timeout),
+      m_maxBatch(maxBatch) {}
+
+bool RequestCoalescer::isSupported(const std::shared_ptr<const ov::Model>& model) {
+    if (!model->get_variables().empty()) {
+        return false;
+    }
+    auto batchedPort = [](const ov::Output<const ov::Node>& port) {
+        const auto& shape = port.get_partial_shape();
+        const auto& type = port.get_element_type();
+        return shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0].is_dynamic() &&
+               type != ov::element::string && type.bitwidth() >= 8;
+    };
+    const auto& inputs = model->inputs();
+    const auto& outputs = model->outputs();
+    return !inputs.empty() && std::all_of(inputs.begin(), inputs.end(), batchedPort) &&
+           std::all_of(outputs.begin(), outputs.end(), batchedPort);
+}
+
+void RequestCoalescer::submit(SyncInferRequest& request,
+                              std::shared_ptr<ov::threading::ITaskExecutor> executor,
+                              Complete complete) {
+    Pending pending{&request, std::move(executor), std::move(complete), {}, 0, std::chrono::steady_clock::now()};
+    bool supported = true;
+    try {
+        for (const auto& port : request.get_inputs()) {
+            const auto tensor = request.get_tensor(port);
+            const auto& shape = tensor->get_shape();
+            if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) || !tensor->is_continuous() ||
+                !request.get_tensors(port).empty() || shape.empty() ||
+                (pending.batch != 0 && shape[0] != pending.batch)) {
+                supported = false;
+                break;
+            }
+            pending.batch = shape[0];
+            pending.shapes.emplace_back(shape.begin() + 1, shape.end());
+        }
+    } catch (const std::exception&) {
+        supported = false;
+    }
+
+    if (!supported || pending.batch == 0 || pending.batch >= m_maxBatch) {
+        // inferred separately by the stream
+        pending.executor->run([complete = std::move(pending.complete)] {
+            complete(false);
+        });
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingBatch += pending.batch;
+    m_pending.push_back(std::move(pending));
+    if (m_pendingBatch >= m_maxBatch) {
+        m_collected.notify_one();
+    }
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        // the submitted request is the oldest one
+        m_pending.back().executor->run([self = shared_from_this()] {
+            self->flush();
+        });
+    }
+}
+
+void RequestCoalescer::flush() {
+    std::vector<Pending> requests;
+    size_t batch = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_collected.wait_until(lock, m_pending.front().submitted + m_timeout, [this] {
+            return m_pendingBatch >= m_maxBatch;
+        });
+        // the oldest request and the following ones with the same shapes which fit the maximum batch
+        const auto shapes = m_pending.front().shapes;
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            if (it->shapes != shapes || batch + it->batch > m_maxBatch) {
+                ++it;
+                continue;
+            }
+            batch += it->batch;
+            m_pendingBatch -= it->batch;
+            requests.push_back(std::move(*it));
+            it = m_pending.erase(it);
+        }
+        if (m_pending.empty()) {
+            m_flushScheduled = false;
+        } else {
+            m_pending.front().executor->run([self = shared_from_this()] {
+                self->flush();
+            });
+        }
+    }
+
+    const auto inferred =
+        requests.size() > 1 ? inferCoalesced(requests, batch) : std::vector<bool>(requests.size(), false);
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].complete(inferred[i]);
+    }
+}
+
+std::vector<bool> RequestCoalescer::inferCoalesced(const std::vector<Pending>& requests, size_t batch) {
+    std::shared_ptr<AsyncInferRequest> coalesced;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_idleRequests.empty()) {
+            coalesced = std::move(m_idleRequests.back());
+            m_idleRequests.pop_back();
+        }
+    }
+
+    std::vector<bool> inferred(requests.size(), false);
+    try {
+        if (!coalesced) {
+            coalesced = m_requestFactory();
+        }
+        auto& request = static_cast<SyncInferRequest&>(*coalesced->m_internal_request);
+
+        const auto& inputs = request.get_inputs();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            ov::Shape shape{batch};
+            shape.insert(shape.end(), requests.front().shapes[i].begin(), requests.front().shapes[i].end());
+            const auto dst = request.get_tensor(inputs[i]);
+            dst->set_shape(shape);
+            auto* dstData = static_cast<uint8_t*>(dst->data());
+            for (const auto& pending : requests) {
+                const auto src = pending.request->get_tensor(pending.request->get_inputs()[i]);
+                std::memcpy(dstData, src->data(), src->get_byte_size());
+                dstData += src->get_byte_size();
+            }
+        }
+
+        request.infer();
+
+        const auto& outputs = request.get_outputs();
+        std::vector<ov::SoPtr<ov::ITensor>> results;
+        for (const auto& output : outputs) {
+            results.push_back(request.get_tensor(output));
+            const auto& shape = results.back()->get_shape();
+            OPENVINO_ASSERT(!shape.empty() && shape[0] == batch,
+                            "The batch of the output ",
+                            output,
+                            " doesn't match the coalesced batch ",
+                            batch);
+        }
+
+        size_t offset = 0;
+        for (size_t r = 0; r < requests.size(); r++) {
+            const auto& pending = requests[r];
+            try {
+                for (size_t i = 0; i < outputs.size(); i++) {
+                    const auto& result = results[i];
+                    const auto itemSize = result->get_byte_size() / batch;
+                    auto shape = result->get_shape();
+                    shape[0] = pending.batch;
+                    const auto dst = pending.request->get_tensor(pending.request->get_outputs()[i]);
+                    if (dst->get_shape() != shape) {
+                        dst->set_shape(shape);
+                    }
+                    std::memcpy(dst->data(),
+                                static_cast<const uint8_t*>(result->data()) + offset * itemSize,
+                                pending.batch * itemSize);
+                }
+                // the inputs staged for the request's own inference are stale for the next one
+                pending.request->drop_staged_inputs();
+                inferred[r] = true;
+            } catch (const std::exception& e) {
+                // the request infers itself and reports the error
+                DEBUG_LOG("Cannot split the coalesced outputs: ", e.what());
+            }
+            offset += pending.batch;
+        }
+    } catch (const std::exception& e) {
+        // all the requests infer themselves and report the errors
+        DEBUG_LOG("Cannot infer the coalesced requests: ", e.what());
+        std::fill(inferred.begin(), inferred.end(), false);
+    }
+
+    if (coalesced) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_idleRequests.push_back(std::move(coalesced));
+    }
+    return inferred;
+}
+
+}  // namespace ov::intel_cpu
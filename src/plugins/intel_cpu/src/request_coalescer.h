@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+class AsyncInferRequest;
+class SyncInferRequest;
+
+/**
+ * Coalesces the concurrent inferences of the requests of a model with a dynamic batch dimension.
+ * The requests submitted within the latency budget, whose inputs have the same shapes apart from the batch dimension,
+ * are inferred by a single graph execution: the inputs are concatenated along the batch dimension into an internal
+ * request and its outputs are split back into the submitted requests.
+ * The coalescing is performed by a task of the streams executor of the model. The task waits until the budget of
+ * the oldest submitted request is exhausted or the maximum batch is collected, so the requests submitted while all
+ * the streams are busy are coalesced without any wait. The task is queued by the executor of the oldest request, so
+ * the coalesced inference has its priority.
+ *
+ * Is a thread safe
+ */
+class RequestCoalescer : public std::enable_shared_from_this<RequestCoalescer> {
+public:
+    using Ptr = std::shared_ptr<RequestCoalescer>;
+    // completes the submitted inference, the argument is false if the request must infer itself
+    using Complete = std::function<void(bool)>;
+    // creates the internal requests inferring the coalesced inputs
+    using RequestFactory = std::function<std::shared_ptr<AsyncInferRequest>()>;
+
+    RequestCoalescer(RequestFactory requestFactory,
+                     std::chrono::microseconds timeout,
+                     size_t maxBatch);
+
+    /**
+     * Checks the model can be coalesced: all the inputs and outputs have a dynamic first dimension, there are no states
+     * and the element types are byte addressable
+     */
+    static bool isSupported(const std::shared_ptr<const ov::Model>& model);
+
+    /**
+     * Schedules the inference of the request, complete is called by the streams executor. The inputs staged by the
+     * request are dropped when the request is inferred by the coalescer
+     * @param executor the executor of the inference task of the request, it queues the request inferring itself and
+     * the coalescing task started by the request
+     */
+    void submit(SyncInferRequest& request, std::shared_ptr<ov::threading::ITaskExecutor> executor, Complete complete);
+
+private:
+    struct Pending {
+        SyncInferRequest* request;
+        std::shared_ptr<ov::threading::ITaskExecutor> executor;
+        Complete complete;
+        // the input shapes without the batch dimension
+        std::vector<ov::Shape> shapes;
+        size_t batch;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    void flush();
+    // returns the requests which are inferred, the others must infer themselves
+    std::vector<bool> inferCoalesced(const std::vector<Pending>& requests, size_t batch);
+
+    RequestFactory m_requestFactory;
+    const std::chrono::microseconds m_timeout;
+    const size_t m_maxBatch;
+
+    std::mutex m_mutex;
+    std::condition_variable m_collected;
+    std::deque<Pending> m_pending;
+    size_t m_pendingBatch = 0;
+    bool m_flushScheduled = false;
+    std::vector<std::shared_ptr<AsyncInferRequest>> m_idleRequests;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,223 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_types.h"
+#include "edge.h"
+#include "graph_context.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+// nanoseconds since the origin shared by all the traces of the process
+int64_t now() {
+    static const auto origin = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+// small sequential thread ids are easier to read in the trace viewers than the native ones
+int threadIndex() {
+    static std::atomic<int> threadsCount{0};
+    thread_local const int index = threadsCount++;
+    return index;
+}
+
+void appendDims(std::string& str, const VectorDims& dims) {
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (i != 0) {
+            str += 'x';
+        }
+        str += dim2str(dims[i]);
+    }
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        case '\t':
+            escaped += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                escaped += ' ';
+            } else {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+// the Chrome trace timestamps are in microseconds
+void writeMicroseconds(std::ostream& os, int64_t ns) {
+    os << ns / 1000 << '.' << static_cast<char>('0' + ns % 1000 / 100) << static_cast<char>('0' + ns % 100 / 10)
+       << static_cast<char>('0' + ns % 10);
+}
+
+}  // namespace
+
+RuntimeTrace::RuntimeTrace(const std::string& pathPrefix) {
+    static std::atomic<size_t> tracesCount{0};
+    const auto path = pathPrefix + "_" + std::to_string(tracesCount++) + ".json";
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    OPENVINO_ASSERT(m_file.is_open(), "Cannot open the runtime trace file ", path);
+}
+
+RuntimeTrace::~RuntimeTrace() {
+    try {
+        write();
+    } catch (...) {
+        // the trace is lost, the request is destroyed anyway
+    }
+}
+
+RuntimeTrace::Event* RuntimeTrace::append(int64_t begin) {
+    if (m_events.size() == maxEvents) {
+        m_droppedEvents++;
+        return nullptr;
+    }
+    auto& event = m_events.emplace_back();
+    event.begin = begin;
+    event.end = now();
+    event.thread = threadIndex();
+    event.stream = m_stream;
+    return &event;
+}
+
+RuntimeTrace::InferScope::InferScope(RuntimeTrace* trace, const GraphContext::CPtr& context) : m_trace(trace) {
+    if (!m_trace) {
+        return;
+    }
+    const auto& streamExecutor = context->getCPUStreamExecutor();
+    m_trace->m_stream = streamExecutor ? streamExecutor->get_stream_id() : 0;
+    m_begin = now();
+}
+
+RuntimeTrace::InferScope::~InferScope() {
+    if (m_trace) {
+        m_trace->append(m_begin);
+    }
+}
+
+RuntimeTrace::NodeScope::NodeScope(RuntimeTrace* trace, const Node& node) : m_trace(trace), m_node(node) {
+    if (m_trace) {
+        m_begin = now();
+    }
+}
+
+RuntimeTrace::NodeScope::~NodeScope() {
+    if (!m_trace) {
+        return;
+    }
+    auto* event = m_trace->append(m_begin);
+    if (!event) {
+        return;
+    }
+    event->name = m_node.getName();
+    event->type = m_node.getType();
+    if (const auto* selectedPD = m_node.getSelectedPrimitiveDescriptor()) {
+        event->impl = selectedPD->getImplementationType();
+    }
+    // the outputs are described after the execution, since the shapes of the dynamic nodes are known by then
+    bool firstInput = true;
+    for (const auto& weakEdge : m_node.getParentEdges()) {
+        const auto edge = weakEdge.lock();
+        if (!edge) {
+            continue;
+        }
+        const auto& memory = edge->getMemory();
+        if (!firstInput) {
+            event->shapes += ',';
+        }
+        firstInput = false;
+        appendDims(event->shapes, memory.getShape().getDims());
+        event->bytes += memory.getSize();
+    }
+    event->shapes += "->";
+    // the child edges of the same output port share the memory
+    std::vector<int> outputPorts;
+    for (const auto& weakEdge : m_node.getChildEdges()) {
+        const auto edge = weakEdge.lock();
+        if (!edge || std::find(outputPorts.begin(), outputPorts.end(), edge->getInputNum()) != outputPorts.end()) {
+            continue;
+        }
+        const auto& memory = edge->getMemory();
+        if (!outputPorts.empty()) {
+            event->shapes += ',';
+        }
+        outputPorts.push_back(edge->getInputNum());
+        appendDims(event->shapes, memory.getShape().getDims());
+        event->bytes += memory.getSize();
+    }
+}
+
+void RuntimeTrace::write() {
+    std::set<int> streams;
+    std::set<std::pair<int, int>> streamThreads;
+    auto& os = m_file;
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : m_events) {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        streams.insert(event.stream);
+        streamThreads.emplace(event.stream, event.thread);
+        os << "{\"ph\":\"X\",\"pid\":" << event.stream << ",\"tid\":" << event.thread << ",\"ts\":";
+        writeMicroseconds(os, event.begin);
+        os << ",\"dur\":";
+        writeMicroseconds(os, event.end - event.begin);
+        if (event.name.empty()) {
+            os << R"(,"name":"Infer","cat":"infer"})";
+            continue;
+        }
+        const auto type = NameFromType(event.type);
+        os << R"(,"name":")" << escapeJson(event.name) << R"(","cat":")" << type << R"(","args":{"type":")" << type
+           << R"(","impl":")" << impl_type_to_string(event.impl) << R"(","shapes":")" << event.shapes
+           << R"(","bytes":)" << event.bytes << "}}";
+    }
+    for (const auto stream : streams) {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << R"({"ph":"M","name":"process_name","pid":)" << stream << R"(,"args":{"name":"stream )" << stream
+           << "\"}}";
+    }
+    for (const auto& [stream, thread] : streamThreads) {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << R"({"ph":"M","name":"thread_name","pid":)" << stream << ",\"tid\":" << thread
+           << R"(,"args":{"name":"thread )" << thread << "\"}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" << m_droppedEvents << "}}\n";
+    m_file.close();
+}
+
+}  // namespace ov::intel_cpu
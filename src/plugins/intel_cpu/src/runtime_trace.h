@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+class Node;
+
+/**
+ * Timeline of the inferences of an infer request and of the nodes executed by them.
+ * Every event keeps the thread and the stream it's executed by, the implementation type of the node, the shapes
+ * of its inputs and outputs and the size of the memory it reads and writes.
+ * The timeline is written in the Chrome trace event format (chrome://tracing, Perfetto UI) when the request
+ * is destroyed. The timestamps of all the traces of the process are counted from the same origin.
+ *
+ * Is not thread safe: the events are appended by the thread which infers the request and an infer request
+ * is never inferred by several threads at the same time, so the buffer is written without any synchronization.
+ */
+class RuntimeTrace {
+public:
+    /**
+     * Creates the trace of a request which is written to <pathPrefix>_<n>.json,
+     * where n numbers the traces in the order they are created in the process
+     */
+    explicit RuntimeTrace(const std::string& pathPrefix);
+    ~RuntimeTrace();
+
+    RuntimeTrace(const RuntimeTrace&) = delete;
+    RuntimeTrace& operator=(const RuntimeTrace&) = delete;
+
+    /**
+     * Records an inference of the request executed by the stream of the graph context
+     */
+    class InferScope {
+    public:
+        InferScope(RuntimeTrace* trace, const GraphContext::CPtr& context);
+        ~InferScope();
+
+        InferScope(const InferScope&) = delete;
+        InferScope& operator=(const InferScope&) = delete;
+
+    private:
+        RuntimeTrace* m_trace;
+        int64_t m_begin = 0;
+    };
+
+    /**
+     * Records an execution of the node
+     */
+    class NodeScope {
+    public:
+        NodeScope(RuntimeTrace* trace, const Node& node);
+        ~NodeScope();
+
+        NodeScope(const NodeScope&) = delete;
+        NodeScope& operator=(const NodeScope&) = delete;
+
+    private:
+        RuntimeTrace* m_trace;
+        const Node& m_node;
+        int64_t m_begin = 0;
+    };
+
+private:
+    struct Event {
+        // empty for the inference of the request
+        std::string name;
+        std::string shapes;
+        Type type = Type::Unknown;
+        impl_desc_type impl = impl_desc_type::unknown;
+        int64_t begin = 0;
+        int64_t end = 0;
+        size_t bytes = 0;
+        int thread = 0;
+        int stream = 0;
+    };
+
+    Event* append(int64_t begin);
+    void write();
+
+    // bounds the memory of the long running requests, the events which don't fit are counted only
+    static constexpr size_t maxEvents = 1U << 19U;
+
+    std::ofstream m_file;
+    std::vector<Event> m_events;
+    size_t m_droppedEvents = 0;
+    int m_stream = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -25,7 +25,9 @@ namespace ov::intel_cpu::node {
 
 class SDPAShapeInfer : public ShapeInferEmptyPads {
 public:
-    explicit SDPAShapeInfer(ScaledDotProductAttentionWithKVCache::Config config) : m_config(std::move(config)) {}
+    SDPAShapeInfer(ScaledDotProductAttentionWithKVCache::Config config, bool kv_cache_eviction)
+        : m_config(std::move(config)),
+          m_kv_cache_eviction(kv_cache_eviction) {}
 
     IShapeInfer::Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
                               [[maybe_unused]] const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
@@ -63,6 +65,13 @@ public:
                 for (int i = attn_mask_dims_size - 1; i >= 0; i--) {
                     attn_mask_ok = attn_mask_ok && check_broadcast(attn_mask_dims[i], weight_dims[i + offset]);
                 }
+                // the mask of all the session tokens is longer than the cache evicted by the sliding window
+                if (m_kv_cache_eviction && !attn_mask_ok) {
+                    attn_mask_ok = attn_mask_dims.back() > weight_dims.back();
+                    for (int i = attn_mask_dims_size - 2; i >= 0; i--) {
+                        attn_mask_ok = attn_mask_ok && check_broadcast(attn_mask_dims[i], weight_dims[i + offset]);
+                    }
+                }
             } else {
                 attn_mask_ok = false;
             }
@@ -156,13 +165,14 @@ public:
 
 private:
     ScaledDotProductAttentionWithKVCache::Config m_config;
+    bool m_kv_cache_eviction = false;
 };
 
 ShapeInferPtr SDPAShapeInferFactory::makeShapeInfer() const {
     if (auto sdpa = ov::as_type_ptr<const ScaledDotProductAttentionWithKVCache>(m_op)) {
         const auto& config = sdpa->get_config();
         if (!config.output_BLHxS) {
-            return std::make_shared<SDPAShapeInfer>(config);
+            return std::make_shared<SDPAShapeInfer>(config, m_kv_cache_eviction && config.fuse_concat);
         }
     }
     // fallback to ngraph shape infer on non-perf-critical case
@@ -14,10 +14,14 @@ namespace ov::intel_cpu::node {
 
 class SDPAShapeInferFactory : public ShapeInferFactory {
 public:
-    explicit SDPAShapeInferFactory(std::shared_ptr<ov::Node> op) : m_op(std::move(op)) {}
+    explicit SDPAShapeInferFactory(std::shared_ptr<ov::Node> op, bool kv_cache_eviction = false)
+        : m_op(std::move(op)),
+          m_kv_cache_eviction(kv_cache_eviction) {}
     [[nodiscard]] ShapeInferPtr makeShapeInfer() const override;
 
 private:
     std::shared_ptr<ov::Node> m_op;
+    // the KV cache may be evicted, so the attention mask may be longer than the cache
+    bool m_kv_cache_eviction = false;
 };
 }  // namespace ov::intel_cpu::node
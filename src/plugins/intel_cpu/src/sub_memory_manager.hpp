@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <mutex>
 #include <vector>
 
@@ -25,6 +27,10 @@ public:
         memorys.assign(_num_sub_streams, memory_info);
         _memorys_table.assign(2, memorys);
         _use_count.assign(2, 0);
+        _ready_rows.reserve(2);
+        for (int i = 0; i < 2; i++) {
+            _ready_rows.emplace_back(_num_sub_streams);
+        }
     }
 
     int get_memory_id(int sub_stream_id) {
@@ -44,6 +50,8 @@ public:
     int _num_sub_streams;
     std::vector<std::vector<MemoryInfo>> _memorys_table;
     std::vector<int> _use_count;
+    // the number of the rows of send_buf published by each sub-stream computing the output by chunks
+    std::vector<std::vector<std::atomic<size_t>>> _ready_rows;
     std::mutex _flagMutex;
 };
 }  // namespace ov::intel_cpu
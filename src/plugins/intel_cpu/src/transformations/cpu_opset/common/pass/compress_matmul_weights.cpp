@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compress_matmul_weights.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "utils/general_utils.h"
+
+namespace {
+
+// Packs the values, which are stored one per byte, two per byte with the first value in the low half
+std::vector<uint8_t> pack_u4(const std::vector<uint8_t>& values) {
+    std::vector<uint8_t> packed((values.size() + 1) / 2, 0);
+    for (size_t i = 0; i < values.size(); i++) {
+        packed[i / 2] |= static_cast<uint8_t>((values[i] & 0x0F) << (4 * (i % 2)));
+    }
+    return packed;
+}
+
+}  // namespace
+
+ov::intel_cpu::CompressMatMulWeights::CompressMatMulWeights(const ov::element::Type& weights_type,
+                                                             size_t group_size) {
+    MATCHER_SCOPE(CompressMatMulWeights);
+    using namespace ov::pass::pattern;
+    OPENVINO_ASSERT(any_of(weights_type, ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4),
+                    "CompressMatMulWeights: unsupported weights type ",
+                    weights_type);
+
+    auto activations_m = any_input(has_static_rank());
+    auto weights_m = wrap_type<ov::op::v0::Constant>(
+        type_matches_any({ov::element::f32, ov::element::f16, ov::element::bf16}) && rank_equals(2));
+    auto convert_m = optional<ov::op::v0::Convert>({weights_m}, consumers_count(1));
+    auto matmul_m = wrap_type<ov::op::v0::MatMul>({activations_m, convert_m});
+
+    // the compressed weights are looked up by the source constant, the weak pointers don't keep the replaced subgraphs
+    // alive and detect a source constant whose address is reused after it's destroyed
+    struct CompressedWeights {
+        std::weak_ptr<ov::Node> source;
+        std::weak_ptr<ov::Node> decompressed;
+    };
+    auto compressed_cache =
+        std::make_shared<std::map<std::tuple<const ov::Node*, bool, ov::element::Type>, CompressedWeights>>();
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        auto weights = ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(weights_m).get_node_shared_ptr());
+        if (!matmul || !weights || transformation_callback(matmul)) {
+            return false;
+        }
+        // FullyConnected is not supported for 1D activations
+        if (matmul->get_input_partial_shape(0).size() < 2) {
+            return false;
+        }
+        const auto decompression_type = matmul->get_input_element_type(1);
+        if (!decompression_type.is_real()) {
+            return false;
+        }
+
+        const bool transpose_b = matmul->get_transpose_b();
+        // the MatMuls sharing the weights share the compressed copy of them too
+        const auto cache_key = std::make_tuple(weights.get(), transpose_b, decompression_type);
+        ov::NodeVector new_nodes;
+        auto compress = [&]() -> std::shared_ptr<ov::Node> {
+            const auto& shape = weights->get_shape();
+            const size_t OC = transpose_b ? shape[0] : shape[1];
+            const size_t IC = transpose_b ? shape[1] : shape[0];
+            const bool grouped = group_size != 0 && group_size < IC && IC % group_size == 0;
+            const size_t G = grouped ? group_size : IC;
+            const size_t groups = IC / G;
+
+            const bool is_signed = weights_type.is_signed();
+            const bool is_4bit = weights_type.bitwidth() == 4;
+            // the symmetric range is [-levels, levels], the asymmetric one is [0, levels]
+            const int levels = is_signed ? (is_4bit ? 7 : 127) : (is_4bit ? 15 : 255);
+
+            const auto values = weights->cast_vector<float>();
+            auto value = [&](size_t oc, size_t ic) {
+                return transpose_b ? values[oc * IC + ic] : values[ic * OC + oc];
+            };
+
+            // the compressed weights are stored as [OC, IC] one value per byte and packed later if needed
+            std::vector<uint8_t> quantized(OC * IC);
+            std::vector<float> scales(OC * groups);
+            std::vector<uint8_t> zero_points(is_signed ? 0 : OC * groups);
+            ov::parallel_for(OC, [&](size_t oc) {
+                for (size_t g = 0; g < groups; g++) {
+                    float min_val = 0.F;
+                    float max_val = 0.F;
+                    for (size_t ic = g * G; ic < (g + 1) * G; ic++) {
+                        min_val = std::min(min_val, value(oc, ic));
+                        max_val = std::max(max_val, value(oc, ic));
+                    }
+                    float scale = 1.F;
+                    int zero_point = 0;
+                    if (is_signed) {
+                        const float abs_max = std::max(-min_val, max_val);
+                        scale = abs_max > 0.F ? abs_max / static_cast<float>(levels) : 1.F;
+                    } else {
+                        scale = max_val > min_val ? (max_val - min_val) / static_cast<float>(levels) : 1.F;
+                        zero_point = std::clamp(static_cast<int>(std::round(-min_val / scale)), 0, levels);
+                        zero_points[oc * groups + g] = static_cast<uint8_t>(zero_point);
+                    }
+                    scales[oc * groups + g] = scale;
+                    for (size_t ic = g * G; ic < (g + 1) * G; ic++) {
+                        const int q = static_cast<int>(std::round(value(oc, ic) / scale)) + zero_point;
+                        quantized[oc * IC + ic] = static_cast<uint8_t>(std::clamp(q, is_signed ? -levels : 0, levels));
+                    }
+                }
+            });
+
+            const auto weights_shape = grouped ? ov::Shape{OC, groups, G} : ov::Shape{OC, IC};
+            const auto params_shape = grouped ? ov::Shape{OC, groups, 1} : ov::Shape{OC, 1};
+            auto make_compressed_constant = [&](const ov::Shape& const_shape, const std::vector<uint8_t>& data) {
+                if (is_4bit) {
+                    return std::make_shared<ov::op::v0::Constant>(weights_type, const_shape, pack_u4(data).data());
+                }
+                return std::make_shared<ov::op::v0::Constant>(weights_type, const_shape, data.data());
+            };
+
+            auto compressed_weights = make_compressed_constant(weights_shape, quantized);
+            std::shared_ptr<ov::Node> decompressed =
+                std::make_shared<ov::op::v0::Convert>(compressed_weights, decompression_type);
+            new_nodes.insert(new_nodes.end(), {compressed_weights, decompressed});
+            if (!is_signed) {
+                auto zero_point = make_compressed_constant(params_shape, zero_points);
+                auto zero_point_convert = std::make_shared<ov::op::v0::Convert>(zero_point, decompression_type);
+                decompressed = std::make_shared<ov::op::v1::Subtract>(decompressed, zero_point_convert);
+                new_nodes.insert(new_nodes.end(), {zero_point, zero_point_convert, decompressed});
+            }
+            auto scale = ov::op::v0::Constant::create(decompression_type, params_shape, scales);
+            decompressed = std::make_shared<ov::op::v1::Multiply>(decompressed, scale);
+            new_nodes.insert(new_nodes.end(), {scale, decompressed});
+            if (grouped) {
+                auto target_shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {OC, IC});
+                decompressed = std::make_shared<ov::op::v1::Reshape>(decompressed, target_shape, false);
+                new_nodes.insert(new_nodes.end(), {target_shape, decompressed});
+            }
+            return decompressed;
+        };
+
+        std::shared_ptr<ov::Node> decompressed;
+        auto cached = compressed_cache->find(cache_key);
+        if (cached != compressed_cache->end() && cached->second.source.lock() == weights) {
+            decompressed = cached->second.decompressed.lock();
+        }
+        if (!decompressed) {
+            decompressed = compress();
+            (*compressed_cache)[cache_key] = {weights, decompressed};
+        }
+
+        auto new_matmul = std::make_shared<ov::op::v0::MatMul>(pattern_map.at(activations_m),
+                                                               decompressed,
+                                                               matmul->get_transpose_a(),
+                                                               true);
+        new_nodes.push_back(new_matmul);
+        new_matmul->set_friendly_name(matmul->get_friendly_name());
+        ov::copy_runtime_info(m.get_matched_nodes(), new_nodes);
+        ov::replace_node(matmul, new_matmul);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * This transformation quantizes the f32/f16/bf16 constant weights of MatMul without any calibration data and replaces
+ * them with the decompression subgraph of the compressed weights. The subgraph is the same as the one produced by the
+ * offline weights compression, so the MatMul is then converted to the compressed FullyConnected. The weights are
+ * quantized per group of the input channels, the unsigned types are asymmetric (with zero points), the signed types
+ * are symmetric.
+ *
+ *                                           Weights(u4)[OC, IC/G, G]  ZP(u4)[OC, IC/G, 1]
+ *                                                 |                        |
+ *                                              Convert                  Convert
+ *                                                   \                     /
+ *    Weights(f32)[IC, OC]                              Subtract(asym only)
+ *          |                                                  |
+ *    Convert(opt)                 ====>                   Multiply -- Scale[OC, IC/G, 1]
+ *          |                                                  |
+ *  Data    |                                           Reshape[OC, IC]
+ *      \   |                                             Data |
+ *       MatMul                                             \  |
+ *                                                         MatMul(transpose_b=true)
+ */
+class CompressMatMulWeights : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("CompressMatMulWeights");
+    /**
+     * @param weights_type u8/u4 for the asymmetric and i8/i4 for the symmetric compression
+     * @param group_size the number of the input channels sharing a scale, 0 or a size which doesn't split the input
+     * channels evenly means a scale per output channel
+     */
+    CompressMatMulWeights(const ov::element::Type& weights_type, size_t group_size);
+};
+
+}  // namespace ov::intel_cpu
@@ -7,11 +7,13 @@
 #include <cassert>
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "onednn/dnnl.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -103,6 +105,107 @@ void BrgemmCPUBlocking::create_not_processed_postops_ports(const ov::snippets::l
                       {{m_block, new_ports}, {n_block, new_ports}, {k_block, new_ports}});
 }
 
+BrgemmCPUBlocking::CacheSizes BrgemmCPUBlocking::CacheSizes::host() {
+    return {static_cast<size_t>(dnnl::utils::get_cache_size(1, true)),
+            static_cast<size_t>(dnnl::utils::get_cache_size(2, true))};
+}
+
+namespace {
+// Estimates the memory traffic in bytes of the blocked Brgemm with the loops order M -> N -> K (K is the innermost).
+// The blocks processed by one kernel call have to fit into the half of L2, the other half is left for the data reused
+// between the calls.
+size_t estimate_blocked_brgemm_traffic(size_t m,
+                                       size_t n,
+                                       size_t k,
+                                       size_t m_blk,
+                                       size_t n_blk,
+                                       size_t k_blk,
+                                       size_t src_size,
+                                       size_t wei_size,
+                                       const BrgemmCPUBlocking::CacheSizes& cache_sizes) {
+    constexpr size_t acc_size = sizeof(float);
+    // the cost of a kernel call: the loop overhead and the accumulators initialization
+    constexpr size_t call_overhead = 1024;
+    const size_t l2_budget = cache_sizes.l2 / 2;
+
+    const size_t a_blk_size = m_blk * k_blk * src_size;
+    const size_t b_blk_size = k_blk * n_blk * wei_size;
+    const size_t c_blk_size = m_blk * n_blk * acc_size;
+    if (a_blk_size + b_blk_size + c_blk_size > l2_budget) {
+        return std::numeric_limits<size_t>::max();
+    }
+
+    const size_t m_blocks = div_up(m, m_blk);
+    const size_t n_blocks = div_up(n, n_blk);
+    const size_t k_blocks = div_up(k, k_blk);
+    // B is read once if it stays in L2 between the M blocks
+    const size_t b_size = k * n * wei_size;
+    const size_t b_traffic = b_size <= l2_budget ? b_size : b_size * m_blocks;
+    // the rows panel of A is read once if it stays in L2 between the N blocks
+    const size_t a_panel_size = m_blk * k * src_size;
+    const size_t a_traffic = m * k * src_size * (a_panel_size + b_blk_size <= l2_budget ? 1 : n_blocks);
+    // the C block is accumulated over the K blocks and is reloaded on each of them if it doesn't fit L1
+    const size_t c_traffic = m * n * acc_size * (c_blk_size <= cache_sizes.l1 / 2 ? 1 : 2 * k_blocks);
+    return a_traffic + b_traffic + c_traffic + m_blocks * n_blocks * k_blocks * call_overhead;
+}
+}  // namespace
+
+std::pair<size_t, size_t> BrgemmCPUBlocking::select_mk_blocks_by_cost_model(size_t m,
+                                                                            size_t n,
+                                                                            size_t k,
+                                                                            size_t m_blk,
+                                                                            size_t n_blk,
+                                                                            size_t k_blk,
+                                                                            bool is_k_blocking_allowed,
+                                                                            size_t src_size,
+                                                                            size_t wei_size,
+                                                                            const CacheSizes& cache_sizes) {
+    if (cache_sizes.l1 == 0 || cache_sizes.l2 == 0 || is_dynamic_value(m) || is_dynamic_value(n) ||
+        is_dynamic_value(k)) {
+        return {m_blk, k_blk};
+    }
+
+    auto estimate = [&](size_t m_candidate, size_t k_candidate) {
+        auto actual_blk = [](size_t dim, size_t blk) {
+            return is_full_dim_value(blk) ? dim : blk;
+        };
+        return estimate_blocked_brgemm_traffic(m,
+                                               n,
+                                               k,
+                                               actual_blk(m, m_candidate),
+                                               actual_blk(n, n_blk),
+                                               actual_blk(k, k_candidate),
+                                               src_size,
+                                               wei_size,
+                                               cache_sizes);
+    };
+
+    std::vector<size_t> m_candidates{m_blk};
+    for (const size_t blk : {32, 64, 128}) {
+        m_candidates.push_back(get_corrected_blk_size_by_dim(m, blk));
+    }
+    std::vector<size_t> k_candidates{k_blk};
+    if (is_k_blocking_allowed) {
+        for (const size_t blk : {256, 512, 1024, 2048}) {
+            k_candidates.push_back(get_corrected_blk_size_by_dim(k, blk));
+        }
+    }
+
+    // the default blocks win the ties
+    std::pair<size_t, size_t> best{m_blk, k_blk};
+    size_t best_traffic = estimate(m_blk, k_blk);
+    for (const auto m_candidate : m_candidates) {
+        for (const auto k_candidate : k_candidates) {
+            const auto traffic = estimate(m_candidate, k_candidate);
+            if (traffic < best_traffic) {
+                best_traffic = traffic;
+                best = {m_candidate, k_candidate};
+            }
+        }
+    }
+    return best;
+}
+
 bool BrgemmCPUBlocking::is_kn_blocking_supported(const ov::element::Type& input_type) {
     return input_type == element::f32;
 }
@@ -135,6 +238,16 @@ std::tuple<size_t, size_t, size_t> BrgemmCPUBlocking::get_blocking_params(
         n_blk = get_full_dim_value();
         k_blk = get_full_dim_value();
     }
+    std::tie(m_blk, k_blk) = select_mk_blocks_by_cost_model(m,
+                                                            n,
+                                                            k,
+                                                            m_blk,
+                                                            n_blk,
+                                                            k_blk,
+                                                            is_kn_blocking_supported(brgemm->get_input_element_type(1)),
+                                                            brgemm->get_input_element_type(0).size(),
+                                                            brgemm->get_input_element_type(1).size(),
+                                                            m_cache_sizes);
     return std::make_tuple(m_blk, n_blk, k_blk);
 }
 
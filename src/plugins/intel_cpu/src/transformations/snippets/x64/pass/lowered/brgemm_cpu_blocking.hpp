@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <memory>
 #include <tuple>
+#include <utility>
 
 #include "openvino/core/rtti.hpp"
 #include "snippets/lowered/expression.hpp"
@@ -44,9 +45,39 @@ public:
             const std::shared_ptr<snippets::lowered::pass::PassBase>& other) override;
     };
 
+    /**
+     * @brief Per-core data cache sizes in bytes which the blocking parameters are selected for.
+     *        Zero sizes mean that the cache hierarchy is unknown and the default block sizes are used
+     */
+    struct CacheSizes {
+        size_t l1 = 0;
+        size_t l2 = 0;
+
+        static CacheSizes host();
+    };
+
+    BrgemmCPUBlocking() = default;
+    explicit BrgemmCPUBlocking(CacheSizes cache_sizes) : m_cache_sizes(cache_sizes) {}
+
     static bool is_kn_blocking_supported(const ov::element::Type& input_type);
 
 private:
+    /**
+     * @brief Selects M and K blocks which minimize the estimated memory traffic of the blocked Brgemm
+     *        for the given caches. The blocks passed in are returned if the dimensions are dynamic
+     *        or no candidate fits the caches.
+     */
+    static std::pair<size_t, size_t> select_mk_blocks_by_cost_model(size_t m,
+                                                                     size_t n,
+                                                                     size_t k,
+                                                                     size_t m_blk,
+                                                                     size_t n_blk,
+                                                                     size_t k_blk,
+                                                                     bool is_k_blocking_allowed,
+                                                                     size_t src_size,
+                                                                     size_t wei_size,
+                                                                     const CacheSizes& cache_sizes);
+
     static snippets::lowered::LinearIR::constExprIt move_new_memory_buffer(
         snippets::lowered::LinearIR& linear_ir,
         const snippets::lowered::LinearIR::constExprIt& brgemm_it);
@@ -85,6 +116,8 @@ private:
                              size_t m_block,
                              size_t n_block,
                              size_t k_block) override;
+
+    CacheSizes m_cache_sizes;
 };
 
 }  // namespace ov::intel_cpu::pass
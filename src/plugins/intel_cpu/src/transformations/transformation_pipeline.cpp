@@ -142,6 +142,7 @@
 #include "transformations/low_precision/mark_dequantization_subgraph.hpp"
 
 // CPU specific transformations
+#include "transformations/cpu_opset/common/pass/compress_matmul_weights.hpp"
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
@@ -469,6 +470,28 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_ARM(decompression_handling_manager, ov::pass::TransposeMatMul);
     const auto& decompression_precisions =
         ov::intel_cpu::node::FullyConnected::getSupportedCompressedWeightsTypes(true);
+    // Data-free weights compression must precede the decompression marking, its output is handled as the weights
+    // compressed offline
+    const auto weights_compression_type = [&]() {
+        switch (config.weightsCompressionMode) {
+        case Config::WeightsCompressionMode::Int8Sym:
+            return ov::element::i8;
+        case Config::WeightsCompressionMode::Int8Asym:
+            return ov::element::u8;
+        case Config::WeightsCompressionMode::Int4Sym:
+            return ov::element::i4;
+        case Config::WeightsCompressionMode::Int4Asym:
+            return ov::element::u4;
+        default:
+            return ov::element::dynamic;
+        }
+    }();
+    if (contains(decompression_precisions, weights_compression_type)) {
+        CPU_REGISTER_PASS_COMMON(decompression_handling_manager,
+                                 CompressMatMulWeights,
+                                 weights_compression_type,
+                                 config.weightsCompressionGroupSize);
+    }
     CPU_REGISTER_PASS_COMMON(decompression_handling_manager,
                              ov::pass::MarkDequantization,
                              decompression_precisions,
@@ -905,7 +928,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion, true);
 
     manager.run_passes(model);
 }
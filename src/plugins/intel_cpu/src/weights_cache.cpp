@@ -18,6 +18,18 @@
 
 namespace ov::intel_cpu {
 
+void WeightsSharing::DeferredFill::run() {
+    if (done()) {
+        return;
+    }
+    std::call_once(m_once, [this]() {
+        m_fill();
+        // release the captured memory objects
+        m_fill = nullptr;
+        m_done.store(true, std::memory_order_release);
+    });
+}
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -64,6 +76,9 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
             sharedWeights[key] = ptr;
         }
     }
+    if (ptr->deferredFill) {
+        ptr->deferredFill->run();
+    }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                               ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                               : std::unique_lock<std::mutex>(ptr->guard),
@@ -71,6 +86,34 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
                                           newPtr);
 }
 
+std::pair<MemoryPtr, WeightsSharing::DeferredFill::Ptr> WeightsSharing::findOrCreateDeferred(
+    const std::string& key,
+    const std::function<MemoryPtr(void)>& allocate,
+    const std::function<void(const MemoryPtr&)>& fill) {
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+    if (found != sharedWeights.end() && found->second) {
+        if (auto cached = found->second->sharedMemory.lock()) {
+            auto deferredFill = found->second->deferredFill;
+            if (deferredFill && deferredFill->done()) {
+                deferredFill = nullptr;
+            }
+            return {cached, deferredFill};
+        }
+    }
+
+    MemoryPtr newPtr = allocate();
+    // the fill must not prolong the lifetime of the cached object
+    std::weak_ptr<IMemory> weakPtr = newPtr;
+    auto deferredFill = std::make_shared<DeferredFill>([weakPtr, fill]() {
+        if (auto memory = weakPtr.lock()) {
+            fill(memory);
+        }
+    });
+    sharedWeights[key] = std::make_shared<MemoryInfo>(newPtr, true, deferredFill);
+    return {newPtr, deferredFill};
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -31,14 +31,41 @@ namespace ov::intel_cpu {
  * Is a thread safe
  */
 class WeightsSharing {
+public:
+    /**
+     * Filling of the data of a cached memory object which is deferred until the memory is used first.
+     * The fill function is called once, the concurrent callers wait until it's completed.
+     */
+    class DeferredFill {
+    public:
+        using Ptr = std::shared_ptr<DeferredFill>;
+
+        explicit DeferredFill(std::function<void()> fill) : m_fill(std::move(fill)) {}
+
+        void run();
+        [[nodiscard]] bool done() const {
+            return m_done.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::once_flag m_once;
+        std::function<void()> m_fill;
+        std::atomic<bool> m_done{false};
+    };
+
+private:
     struct MemoryInfo {
         using Ptr = std::shared_ptr<MemoryInfo>;
 
-        MemoryInfo(const MemoryPtr& memoryPtr, bool valid) : sharedMemory(memoryPtr), valid(valid) {}
+        MemoryInfo(const MemoryPtr& memoryPtr, bool valid, DeferredFill::Ptr deferredFill = nullptr)
+            : sharedMemory(memoryPtr),
+              valid(valid),
+              deferredFill(std::move(deferredFill)) {}
 
         std::mutex guard;
         std::weak_ptr<IMemory> sharedMemory;
         std::atomic<bool> valid;
+        DeferredFill::Ptr deferredFill;
     };
 
 public:
@@ -71,6 +98,15 @@ public:
                                    const std::function<MemoryPtr(void)>& create,
                                    bool valid = true);
 
+    /**
+     * Returns a cached object or allocates a new one whose data is filled by the returned deferred fill later.
+     * The fill of a cached object is returned as well until it's done, so all the users of the object can wait for it.
+     * The cached objects returned by findOrCreate are always filled.
+     */
+    std::pair<MemoryPtr, DeferredFill::Ptr> findOrCreateDeferred(const std::string& key,
+                                                                 const std::function<MemoryPtr(void)>& allocate,
+                                                                 const std::function<void(const MemoryPtr&)>& fill);
+
     SharedMemory::Ptr get(const std::string& key) const;
 
 #ifdef CPU_DEBUG_CAPS
@@ -0,0 +1,265 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_placement.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "cpu_memory.h"
+#include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "openvino/core/visibility.hpp"
+#include "openvino/runtime/threading/cpu_streams_info.hpp"
+#include "utils/debug_capabilities.h"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <xmmintrin.h>
+#endif
+
+#if defined(__linux__)
+#    include <unistd.h>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr size_t cacheLineSize = 64;
+
+// the lines are prefetched into the last level cache, the thread prefetching a line isn't the only one reading it
+void prefetchBytes(const uint8_t* data, size_t size) {
+    for (size_t offset = 0; offset < size; offset += cacheLineSize) {
+#if defined(OPENVINO_ARCH_X86_64)
+        _mm_prefetch(reinterpret_cast<const char*>(data + offset), _MM_HINT_T2);
+#elif defined(__GNUC__)
+        __builtin_prefetch(data + offset, 0, 1);
+#endif
+    }
+}
+
+}  // namespace
+
+size_t WeightsPlacement::pageSize() {
+#if defined(__linux__)
+    static const auto size = static_cast<size_t>(getpagesize());
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+thread_local const WeightsPlacement* WeightsPlacement::t_scopePlacement = nullptr;
+thread_local const Node* WeightsPlacement::t_scopeNode = nullptr;
+
+WeightsPlacement::Scope::Scope(const Ptr& placement, const Node* node) : m_placement(placement.get()) {
+    if (m_placement) {
+        m_prevPlacement = std::exchange(t_scopePlacement, m_placement);
+        m_prevNode = std::exchange(t_scopeNode, node);
+    }
+}
+
+WeightsPlacement::Scope::~Scope() {
+    if (m_placement) {
+        t_scopePlacement = m_prevPlacement;
+        t_scopeNode = m_prevNode;
+    }
+}
+
+WeightsPlacement::Ptr WeightsPlacement::create(const Config& config) {
+    return create(config.streamExecutorConfig.get_streams_info_table(),
+                  config.weightsNumaPlacement,
+                  config.numSubStreams,
+                  config.weightsPrefetchSize);
+}
+
+WeightsPlacement::Ptr WeightsPlacement::create(const std::vector<std::vector<int>>& streamsInfo,
+                                               Config::WeightsNumaPlacement numaPlacement,
+                                               int numSubStreams,
+                                               size_t prefetchSize) {
+    std::vector<int> numaNodes;
+    std::vector<size_t> numaNodeThreads;
+    // a single stream spanning several NUMA nodes is described by the rows of its processors on each node
+    const bool crossNumaStream = !streamsInfo.empty() && streamsInfo[0][NUMBER_OF_STREAMS] == 1 &&
+                                 streamsInfo[0][STREAM_NUMA_NODE_ID] < 0 &&
+                                 std::all_of(std::next(streamsInfo.begin()), streamsInfo.end(), [](const auto& row) {
+                                     return row[NUMBER_OF_STREAMS] == 0;
+                                 });
+    if (numaPlacement != Config::WeightsNumaPlacement::Stream && numSubStreams == 0 && crossNumaStream) {
+        for (size_t i = 1; i < streamsInfo.size(); i++) {
+            const auto numaNode = streamsInfo[i][STREAM_NUMA_NODE_ID];
+            const auto threads = static_cast<size_t>(std::max(1, streamsInfo[i][THREADS_PER_STREAM]));
+            const auto it = std::find(numaNodes.begin(), numaNodes.end(), numaNode);
+            if (it == numaNodes.end()) {
+                numaNodes.push_back(numaNode);
+                numaNodeThreads.push_back(threads);
+            } else {
+                numaNodeThreads[std::distance(numaNodes.begin(), it)] += threads;
+            }
+        }
+        if (numaNodes.size() < 2 || std::any_of(numaNodes.begin(), numaNodes.end(), [](int numaNode) {
+                return numaNode < 0;
+            })) {
+            numaNodes.clear();
+            numaNodeThreads.clear();
+        }
+    }
+
+    if (numaNodes.empty() && prefetchSize == 0) {
+        return nullptr;
+    }
+
+    return std::make_shared<WeightsPlacement>(std::move(numaNodes),
+                                              std::move(numaNodeThreads),
+                                              numaPlacement == Config::WeightsNumaPlacement::Partition,
+                                              prefetchSize);
+}
+
+WeightsPlacement::WeightsPlacement(std::vector<int> numaNodes,
+                                   std::vector<size_t> numaNodeThreads,
+                                   bool partition,
+                                   size_t prefetchSize)
+    : m_numaNodes(std::move(numaNodes)),
+      m_numaNodeThreads(std::move(numaNodeThreads)),
+      m_partition(partition),
+      m_prefetchSize(prefetchSize) {}
+
+std::pair<size_t, size_t> WeightsPlacement::slice(const void* data, size_t size, size_t numaNodeIdx) const {
+    const auto totalThreads = std::accumulate(m_numaNodeThreads.begin(), m_numaNodeThreads.end(), size_t{0});
+    const auto base = reinterpret_cast<uintptr_t>(data);
+    auto bound = [&](size_t idx) -> size_t {
+        if (idx == 0) {
+            return 0;
+        }
+        if (idx == m_numaNodes.size()) {
+            return size;
+        }
+        const auto threads = std::accumulate(m_numaNodeThreads.begin(), m_numaNodeThreads.begin() + idx, size_t{0});
+        const auto page = (base + size / totalThreads * threads) / pageSize() * pageSize();
+        return page <= base ? 0 : std::min(size, static_cast<size_t>(page - base));
+    };
+    return {bound(numaNodeIdx), bound(numaNodeIdx + 1)};
+}
+
+bool WeightsPlacement::partitionable(const IMemory& weights) const {
+    // the slices of the outermost dimension are computed by the consecutive threads
+    const auto& desc = weights.getDesc();
+    if (!m_partition || !(desc.getType() & MemoryDescType::Blocked) || desc.getShape().getRank() < 2) {
+        return false;
+    }
+    const auto& order = desc.as<BlockedMemoryDesc>()->getOrder();
+    return !order.empty() && order[0] == 0;
+}
+
+void WeightsPlacement::place(const MemoryCPtr& weights) {
+    if (!weights || weights->getSize() == 0) {
+        return;
+    }
+    // the weights shared by the nodes or returned again to the node are placed once per node
+    if (t_scopePlacement == this && t_scopeNode != nullptr) {
+        const auto* node = t_scopeNode;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto [it, inserted] = m_nodeIndices.emplace(node, m_nodeWeights.size());
+        if (inserted) {
+            m_nodeWeights.push_back({node, {}});
+        }
+        auto& nodeWeights = m_nodeWeights[it->second].weights;
+        // the weights released by the node, e.g. repacked for the previous shapes, are no longer registered
+        nodeWeights.erase(std::remove_if(nodeWeights.begin(),
+                                         nodeWeights.end(),
+                                         [](const auto& registered) {
+                                             return registered.expired();
+                                         }),
+                          nodeWeights.end());
+        if (std::any_of(nodeWeights.begin(), nodeWeights.end(), [&weights](const auto& registered) {
+                return registered.lock() == weights;
+            })) {
+            return;
+        }
+        nodeWeights.push_back(weights);
+        m_prefetchTableChanged.store(true, std::memory_order_release);
+    }
+    if (!spreadsWeights()) {
+        return;
+    }
+
+    auto* data = static_cast<uint8_t*>(weights->getData());
+    bool placed = true;
+    if (partitionable(*weights)) {
+        for (size_t i = 0; i < m_numaNodes.size(); i++) {
+            const auto [begin, end] = slice(data, weights->getSize(), i);
+            if (begin != end) {
+                placed = mbind_move(data + begin, end - begin, m_numaNodes[i]) && placed;
+            }
+        }
+    } else {
+        placed = mbind_interleave(data, weights->getSize(), m_numaNodes);
+    }
+    if (!placed) {
+        DEBUG_LOG("Spreading of the weights over the NUMA nodes failed");
+    }
+}
+
+void WeightsPlacement::publishPrefetchTable() {
+    // the execution doesn't wait for the registration, the next node publishes the table otherwise
+    std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || !m_prefetchTableChanged.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    auto table = std::make_unique<PrefetchTable>();
+    const bool partitioned = spreadsWeights() && m_partition;
+    for (size_t i = 0; i + 1 < m_nodeWeights.size(); i++) {
+        auto& ranges = (*table)[m_nodeWeights[i].node];
+        size_t budget = m_prefetchSize;
+        for (const auto& registered : m_nodeWeights[i + 1].weights) {
+            const auto memory = registered.lock();
+            if (!memory || budget == 0) {
+                continue;
+            }
+            const auto* data = static_cast<const uint8_t*>(memory->getData());
+            size_t begin = 0;
+            size_t end = memory->getSize();
+            if (partitioned && partitionable(*memory)) {
+                std::tie(begin, end) = slice(data, end, 0);
+            }
+            const auto size = std::min(end - begin, budget);
+            budget -= size;
+            if (size != 0) {
+                ranges.push_back({data + begin, size});
+            }
+        }
+    }
+    m_prefetchTable.store(table.get(), std::memory_order_release);
+    m_prefetchTables.push_back(std::move(table));
+}
+
+void WeightsPlacement::prefetchNextImpl(const Node* node) {
+    if (m_prefetchTableChanged.load(std::memory_order_acquire)) {
+        publishPrefetchTable();
+    }
+    const auto* table = m_prefetchTable.load(std::memory_order_acquire);
+    if (!table) {
+        return;
+    }
+    const auto it = table->find(node);
+    if (it == table->end()) {
+        return;
+    }
+    // the hints are not faulting, so the ranges of the weights released after the table is published are harmless
+    for (const auto& range : it->second) {
+        prefetchBytes(range.data, range.size);
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "cpu_memory.h"
+
+namespace ov::intel_cpu {
+
+class Node;
+
+/**
+ * Placement and prefetch of the repacked constant weights of the graph nodes.
+ * When a single latency stream spans several NUMA nodes, the weights are spread over these nodes, interleaved by pages
+ * or partitioned into contiguous slices in proportion to the threads of the stream on each node, instead of staying
+ * on the NUMA node the stream is assigned to.
+ * The weights are registered in the execution order of the nodes. Before a node with the weights is executed, the
+ * calling thread of the stream issues the prefetch hints for the beginning of the weights of the next such node, so
+ * they are loaded into the last level cache concurrently with the compute of the node. With the partitioned placement
+ * only the slice of the first NUMA node of the stream, the one of its calling thread, is prefetched.
+ *
+ * Is a thread safe
+ */
+class WeightsPlacement {
+public:
+    using Ptr = std::shared_ptr<WeightsPlacement>;
+
+    /**
+     * Registers the weights placed by the current thread in the scope for the node
+     */
+    class Scope {
+    public:
+        Scope(const Ptr& placement, const Node* node);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        WeightsPlacement* m_placement;
+        const WeightsPlacement* m_prevPlacement = nullptr;
+        const Node* m_prevNode = nullptr;
+    };
+
+    // returns nullptr if the weights are neither spread nor prefetched
+    static Ptr create(const Config& config);
+    /**
+     * The weights are spread if the streams info table describes a single stream spanning several NUMA nodes: a row
+     * of the stream without a NUMA node id followed by the rows of its processors on each node
+     */
+    static Ptr create(const std::vector<std::vector<int>>& streamsInfoTable,
+                      Config::WeightsNumaPlacement numaPlacement,
+                      int numSubStreams,
+                      size_t prefetchSize);
+
+    WeightsPlacement(std::vector<int> numaNodes,
+                     std::vector<size_t> numaNodeThreads,
+                     bool partition,
+                     size_t prefetchSize);
+
+    WeightsPlacement(const WeightsPlacement&) = delete;
+    WeightsPlacement& operator=(const WeightsPlacement&) = delete;
+
+    // the spread weights must not be moved to the NUMA node of the stream
+    [[nodiscard]] bool spreadsWeights() const {
+        return !m_numaNodes.empty();
+    }
+
+    // places the weights and registers them for the prefetch with the node of the current scope
+    void place(const MemoryCPtr& weights);
+
+    [[nodiscard]] const std::vector<int>& numaNodes() const {
+        return m_numaNodes;
+    }
+
+    [[nodiscard]] const std::vector<size_t>& numaNodeThreads() const {
+        return m_numaNodeThreads;
+    }
+
+    // prefetches the weights of the node following the one about to be executed, doesn't wait for the loads
+    void prefetchNext(const Node* node) {
+        if (m_prefetchSize != 0) {
+            prefetchNextImpl(node);
+        }
+    }
+
+    /**
+     * The bytes range of the slice of the NUMA node for the partition placement. The bounds of the slices are
+     * the boundaries of the pages of the absolute addresses, since a page is placed as a whole
+     */
+    [[nodiscard]] std::pair<size_t, size_t> slice(const void* data, size_t size, size_t numaNodeIdx) const;
+
+    static size_t pageSize();
+
+private:
+    struct NodeWeights {
+        const Node* node;
+        std::vector<std::weak_ptr<const IMemory>> weights;
+    };
+
+    struct PrefetchRange {
+        const uint8_t* data;
+        size_t size;
+    };
+    // the ranges of the weights of the next node for each registered node
+    using PrefetchTable = std::unordered_map<const Node*, std::vector<PrefetchRange>>;
+
+    void prefetchNextImpl(const Node* node);
+    void publishPrefetchTable();
+    [[nodiscard]] bool partitionable(const IMemory& weights) const;
+
+    const std::vector<int> m_numaNodes;
+    const std::vector<size_t> m_numaNodeThreads;
+    const bool m_partition;
+    const size_t m_prefetchSize;
+
+    std::mutex m_mutex;
+    // the weights in the order of the nodes registration
+    std::vector<NodeWeights> m_nodeWeights;
+    std::unordered_map<const Node*, size_t> m_nodeIndices;
+
+    // the immutable table read by the execution without the lock, republished once the registered weights are changed.
+    // The replaced tables are kept until destruction since a concurrent execution may still read them, they are only
+    // replaced when the weights of a dynamic node are prepared for the new shapes
+    std::atomic<bool> m_prefetchTableChanged{false};
+    std::atomic<const PrefetchTable*> m_prefetchTable{nullptr};
+    std::vector<std::unique_ptr<const PrefetchTable>> m_prefetchTables;
+
+    // the scope of the current thread, the dynamic nodes may prepare the weights concurrently
+    static thread_local const WeightsPlacement* t_scopePlacement;
+    static thread_local const Node* t_scopeNode;
+};
+
+}  // namespace ov::intel_cpu
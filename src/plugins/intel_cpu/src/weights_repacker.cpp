@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_repacker.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+WeightsRepacker::Scope::Scope(const Ptr& repacker, const Node* node) : m_repacker(repacker.get()) {
+    if (m_repacker) {
+        m_prevNode = m_repacker->m_node.exchange(node);
+    }
+}
+
+WeightsRepacker::Scope::~Scope() {
+    if (m_repacker) {
+        m_repacker->m_node.store(m_prevNode);
+    }
+}
+
+WeightsRepacker::~WeightsRepacker() {
+    m_stop.store(true);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void WeightsRepacker::defer(const DeferredFill::Ptr& fill) {
+    const auto* node = m_node.load(std::memory_order_relaxed);
+    if (!fill || !node) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_fills.push_back(fill);
+    m_nodeFills[node].push_back(fill);
+    m_allDone.store(false, std::memory_order_release);
+}
+
+void WeightsRepacker::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running || m_nextFill == m_fills.size()) {
+        return;
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    m_running = true;
+    m_thread = std::thread([this]() {
+        run();
+    });
+}
+
+void WeightsRepacker::run() {
+    while (!m_stop.load()) {
+        DeferredFill::Ptr fill;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_nextFill == m_fills.size()) {
+                // the failed fills are left to the nodes execution
+                if (std::all_of(m_fills.begin(), m_fills.end(), [](const DeferredFill::Ptr& fill) {
+                        return fill->done();
+                    })) {
+                    m_fills.clear();
+                    m_nextFill = 0;
+                    m_nodeFills.clear();
+                    m_allDone.store(true, std::memory_order_release);
+                }
+                m_running = false;
+                return;
+            }
+            fill = m_fills[m_nextFill++];
+        }
+        try {
+            fill->run();
+        } catch (const std::exception& e) {
+            // the fill is repeated by the node execution which reports the error
+            DEBUG_LOG("Deferred weights packing failed: ", e.what());
+        }
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+}
+
+void WeightsRepacker::waitImpl(const Node* node) {
+    std::vector<DeferredFill::Ptr> fills;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_nodeFills.find(node);
+        if (it == m_nodeFills.end()) {
+            return;
+        }
+        fills = it->second;
+    }
+    // the fills which are being packed by the background thread are waited for
+    for (const auto& fill : fills) {
+        fill->run();
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_nodeFills.erase(node);
+}
+
+}  // namespace ov::intel_cpu
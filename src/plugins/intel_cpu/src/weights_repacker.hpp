@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "weights_cache.hpp"
+
+namespace ov::intel_cpu {
+
+class Node;
+
+/**
+ * Deferred repacking of the constant weights of the graph nodes.
+ * The weights packing requested by the primitives creation of a node at the graph compilation is deferred until
+ * the node is executed first. Meanwhile a background thread packs the weights in the execution order of the nodes,
+ * so the packing runs ahead of the execution and the first inference doesn't wait for the whole model to be packed.
+ *
+ * Is a thread safe
+ */
+class WeightsRepacker {
+public:
+    using Ptr = std::shared_ptr<WeightsRepacker>;
+    using DeferredFill = WeightsSharing::DeferredFill;
+
+    /**
+     * Collects the weights packing requested in the scope for the node
+     */
+    class Scope {
+    public:
+        Scope(const Ptr& repacker, const Node* node);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        WeightsRepacker* m_repacker;
+        const Node* m_prevNode = nullptr;
+    };
+
+    WeightsRepacker() = default;
+    ~WeightsRepacker();
+
+    WeightsRepacker(const WeightsRepacker&) = delete;
+    WeightsRepacker& operator=(const WeightsRepacker&) = delete;
+
+    [[nodiscard]] bool isCollecting() const {
+        return m_node.load(std::memory_order_relaxed) != nullptr;
+    }
+
+    // defers the fill for the node of the current scope
+    void defer(const DeferredFill::Ptr& fill);
+
+    // starts packing of the collected weights in the background
+    void start();
+
+    // packs the weights of the node which are not packed yet
+    void wait(const Node* node) {
+        if (m_allDone.load(std::memory_order_acquire)) {
+            return;
+        }
+        waitImpl(node);
+    }
+
+private:
+    void waitImpl(const Node* node);
+    void run();
+
+    std::mutex m_mutex;
+    std::atomic<const Node*> m_node{nullptr};
+    // all the fills in the order of the nodes primitives creation
+    std::vector<DeferredFill::Ptr> m_fills;
+    std::unordered_map<const Node*, std::vector<DeferredFill::Ptr>> m_nodeFills;
+    size_t m_nextFill = 0;
+    std::atomic<bool> m_allDone{true};
+    std::atomic<bool> m_stop{false};
+    bool m_running = false;
+    std::thread m_thread;
+};
+
+}  // namespace ov::intel_cpu
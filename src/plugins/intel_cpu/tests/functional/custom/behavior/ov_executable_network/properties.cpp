@@ -6,11 +6,23 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exception.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "utils/properties_test.hpp"
@@ -25,30 +37,37 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
 
     std::vector<ov::PropertyName> expectedSupportedProperties{
+        // read write
+        RW_property(ov::num_streams.name()),
+        RW_property(ov::hint::num_requests.name()),
         // read only
         RO_property(ov::supported_properties.name()),
         RO_property(ov::model_name.name()),
         RO_property(ov::optimal_number_of_infer_requests.name()),
-        RO_property(ov::num_streams.name()),
         RO_property(ov::inference_num_threads.name()),
         RO_property(ov::enable_profiling.name()),
         RO_property(ov::hint::inference_precision.name()),
         RO_property(ov::hint::performance_mode.name()),
         RO_property(ov::hint::execution_mode.name()),
-        RO_property(ov::hint::num_requests.name()),
         RO_property(ov::hint::enable_cpu_pinning.name()),
         RO_property(ov::hint::enable_cpu_reservation.name()),
         RO_property(ov::hint::scheduling_core_type.name()),
         RO_property(ov::hint::model_distribution_policy.name()),
         RO_property(ov::hint::enable_hyper_threading.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::log::level.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
         RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
         RO_property(ov::intel_cpu::tbb_partitioner.name()),
+        RW_property(ov::intel_cpu::infer_request_priority.name()),
+        RW_property(ov::intel_cpu::runtime_trace_path.name()),
         RO_property(ov::hint::dynamic_quantization_group_size.name()),
         RO_property(ov::hint::kv_cache_precision.name()),
         RO_property(ov::key_cache_precision.name()),
@@ -91,11 +110,162 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetROPropertiesThrow) {
 
     for (auto it = properties.begin(); it != properties.end(); ++it) {
         ASSERT_TRUE(it != properties.end());
-        ASSERT_FALSE(it->is_mutable());
+        if (it->is_mutable()) {
+            continue;
+        }
         ASSERT_THROW(compiledModel.set_property({{*it, "DUMMY VALUE"}}), ov::Exception);
     }
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkChangeStreamsAtRuntime) {
+    ov::Core ie;
+    int32_t value = 0;
+
+    OV_ASSERT_NO_THROW(ie.set_property(deviceName, ov::num_streams(1)));
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    auto inferRequest = compiledModel.create_infer_request();
+    OV_ASSERT_NO_THROW(inferRequest.infer());
+
+    const int32_t streams = std::max(1, ov::get_number_of_cpu_cores() / 2);
+    OV_ASSERT_NO_THROW(compiledModel.set_property(ov::num_streams(streams)));
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::num_streams));
+    ASSERT_EQ(streams, value);
+
+    // the requests created before the change keep working on the new streams layout
+    OV_ASSERT_NO_THROW(inferRequest.infer());
+    std::vector<ov::InferRequest> requests;
+    for (int32_t i = 0; i < streams; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        OV_ASSERT_NO_THROW(requests.back().start_async());
+    }
+    for (auto& request : requests) {
+        OV_ASSERT_NO_THROW(request.wait());
+    }
+
+    OV_ASSERT_NO_THROW(compiledModel.set_property(ov::num_streams(1)));
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::num_streams));
+    ASSERT_EQ(1, value);
+    OV_ASSERT_NO_THROW(inferRequest.infer());
+
+    ASSERT_THROW(compiledModel.set_property(ov::enable_profiling(true)), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSetInferRequestPriority) {
+    ov::Core ie;
+    ov::hint::Priority value = ov::hint::Priority::MEDIUM;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::infer_request_priority));
+    ASSERT_EQ(ov::hint::Priority::MEDIUM, value);
+    auto lowPriorityRequest = compiledModel.create_infer_request();
+
+    OV_ASSERT_NO_THROW(compiledModel.set_property(ov::intel_cpu::infer_request_priority(ov::hint::Priority::HIGH)));
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::infer_request_priority));
+    ASSERT_EQ(ov::hint::Priority::HIGH, value);
+    auto highPriorityRequest = compiledModel.create_infer_request();
+
+    OV_ASSERT_NO_THROW(lowPriorityRequest.start_async());
+    OV_ASSERT_NO_THROW(highPriorityRequest.start_async());
+    OV_ASSERT_NO_THROW(lowPriorityRequest.wait());
+    OV_ASSERT_NO_THROW(highPriorityRequest.wait());
+    OV_ASSERT_NO_THROW(highPriorityRequest.infer());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkRuntimeTrace) {
+    ov::Core ie;
+    const std::string tracePrefix = ov::test::utils::generateTestFilePrefix() + "_runtime_trace";
+    std::string value;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::runtime_trace_path));
+    ASSERT_TRUE(value.empty());
+    auto notTracedRequest = compiledModel.create_infer_request();
+
+    OV_ASSERT_NO_THROW(compiledModel.set_property(ov::intel_cpu::runtime_trace_path(tracePrefix)));
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::runtime_trace_path));
+    ASSERT_EQ(tracePrefix, value);
+    std::string tracePath;
+    {
+        auto tracedRequest = compiledModel.create_infer_request();
+        OV_ASSERT_NO_THROW(tracedRequest.infer());
+        OV_ASSERT_NO_THROW(notTracedRequest.infer());
+        OV_ASSERT_NO_THROW(tracedRequest.start_async());
+        OV_ASSERT_NO_THROW(tracedRequest.wait());
+    }
+
+    // the traces are numbered in the order they are created in the process
+    for (size_t i = 0; i < 1024 && tracePath.empty(); i++) {
+        const auto path = tracePrefix + "_" + std::to_string(i) + ".json";
+        if (ov::test::utils::fileExists(path)) {
+            tracePath = path;
+        }
+    }
+    ASSERT_FALSE(tracePath.empty());
+    std::ifstream traceFile(tracePath);
+    const std::string trace((std::istreambuf_iterator<char>(traceFile)), std::istreambuf_iterator<char>());
+    traceFile.close();
+    ov::test::utils::removeFile(tracePath);
+
+    ASSERT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0U);
+    ASSERT_NE(trace.find("\"name\":\"Infer\""), std::string::npos);
+    ASSERT_NE(trace.find("\"impl\":"), std::string::npos);
+    ASSERT_NE(trace.find("\"droppedEvents\":0"), std::string::npos);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkKVCacheSpillDir) {
+    ov::Core ie;
+#if defined(__linux__)
+    OV_ASSERT_NO_THROW(ie.compile_model(model, deviceName, ov::intel_cpu::kv_cache_spill_dir(".")));
+#else
+    // the spill files are rejected at the compilation instead of failing the first inference
+    ASSERT_THROW(ie.compile_model(model, deviceName, ov::intel_cpu::kv_cache_spill_dir(".")), ov::Exception);
+#endif
+    OV_ASSERT_NO_THROW(ie.compile_model(model, deviceName, ov::intel_cpu::kv_cache_spill_dir("")));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkAsyncInputStaging) {
+    // the i64 input is converted to i32 by the plugin, so it can't be shared with the graph and is staged
+    const ov::Shape shape{2, 16, 8};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, shape);
+    auto add = std::make_shared<ov::op::v1::Add>(param, ov::op::v0::Constant::create(ov::element::i64, {1}, {1}));
+    auto stagedModel = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+
+    ov::Core ie;
+    ov::CompiledModel compiledModel =
+        ie.compile_model(stagedModel, deviceName, ov::num_streams(1), ov::intel_cpu::async_input_staging(true));
+    std::vector<ov::InferRequest> requests{compiledModel.create_infer_request(), compiledModel.create_infer_request()};
+    for (int64_t iteration = 0; iteration < 3; ++iteration) {
+        for (size_t i = 0; i < requests.size(); ++i) {
+            auto input = requests[i].get_input_tensor();
+            std::iota(input.data<int64_t>(), input.data<int64_t>() + input.get_size(), iteration * 10 + i);
+            OV_ASSERT_NO_THROW(requests[i].start_async());
+        }
+        for (size_t i = 0; i < requests.size(); ++i) {
+            OV_ASSERT_NO_THROW(requests[i].wait());
+            const auto output = requests[i].get_output_tensor();
+            for (size_t j = 0; j < output.get_size(); ++j) {
+                ASSERT_EQ(iteration * 10 + static_cast<int64_t>(i + j) + 1, output.data<int64_t>()[j]);
+            }
+        }
+    }
+    // synchronous inference converts the inputs itself
+    OV_ASSERT_NO_THROW(requests[0].infer());
+    ASSERT_EQ(int64_t{21}, requests[0].get_output_tensor().data<int64_t>()[0]);
+
+    // the inputs staged for a canceled inference are never consumed by the next synchronous one
+    auto input = requests[1].get_input_tensor();
+    std::fill_n(input.data<int64_t>(), input.get_size(), int64_t{100});
+    OV_ASSERT_NO_THROW(requests[1].start_async());
+    requests[1].cancel();
+    try {
+        requests[1].wait();
+    } catch (const ov::Cancelled&) {
+    }
+    std::fill_n(input.data<int64_t>(), input.get_size(), int64_t{200});
+    OV_ASSERT_NO_THROW(requests[1].infer());
+    ASSERT_EQ(int64_t{201}, requests[1].get_output_tensor().data<int64_t>()[0]);
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCoreStreamsHasHigherPriorityThanThroughputHint) {
     ov::Core ie;
     int32_t streams = 1;  // throughput hint should apply higher number of streams
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+// Convolution -> Relu -> Reshape -> MatMul -> Relu -> MatMul with the weights repacking deferred until the first
+// execution of the nodes
+class DeferWeightsRepackingTest : public testing::WithParamInterface<InputShape>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InputShape>& obj) {
+        std::ostringstream result;
+        result << "IS=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes({GetParam()});
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        configuration.insert({ov::intel_cpu::defer_weights_repacking.name(), true});
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto convWeights = ov::test::utils::make_constant(precision, std::vector<size_t>{32, 16, 3, 3});
+        auto conv = ov::test::utils::make_convolution(param,
+                                                      convWeights,
+                                                      precision,
+                                                      std::vector<size_t>{3, 3},
+                                                      std::vector<size_t>{1, 1},
+                                                      ov::CoordinateDiff{1, 1},
+                                                      ov::CoordinateDiff{1, 1},
+                                                      std::vector<size_t>{1, 1},
+                                                      ov::op::PadType::EXPLICIT,
+                                                      32,
+                                                      true);
+        auto convRelu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, std::vector<int64_t>{-1, 32 * 8 * 8});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(convRelu, shape, false);
+
+        auto fc1Weights = ov::test::utils::make_constant(precision, ov::Shape{64, 32 * 8 * 8});
+        auto fc1 = std::make_shared<ov::op::v0::MatMul>(reshape, fc1Weights, false, true);
+        auto fc1Relu = std::make_shared<ov::op::v0::Relu>(fc1);
+        auto fc2Weights = ov::test::utils::make_constant(precision, ov::Shape{64, 10});
+        auto fc2 = std::make_shared<ov::op::v0::MatMul>(fc1Relu, fc2Weights);
+
+        function = std::make_shared<ov::Model>(fc2, ov::ParameterVector{param}, "DeferWeightsRepacking");
+    }
+};
+
+TEST_P(DeferWeightsRepackingTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{2, 16, 8, 8}}},
+    {{-1, 16, 8, 8}, {{1, 16, 8, 8}, {3, 16, 8, 8}, {1, 16, 8, 8}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DeferWeightsRepacking,
+                         DeferWeightsRepackingTest,
+                         ::testing::ValuesIn(inputShapes),
+                         DeferWeightsRepackingTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
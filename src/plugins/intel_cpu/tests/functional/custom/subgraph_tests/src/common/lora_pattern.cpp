@@ -8,7 +8,9 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -233,6 +235,58 @@ protected:
     static constexpr size_t N = 2048ul;  // Weights matrix N dimension
 };
 
+class LoraPatternMultiAdapterMatmulCPUTest : public LoraPatternBaseCPUTest {
+protected:
+    void init_function() override {
+        ov::PartialShape shape_x = {-1, -1, K};
+        ov::PartialShape shape_w = {N, K};
+
+        auto param_y = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        // the adapter of each sequence of the batch
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_y, param_w, false, true);
+
+        // the banks of the LoRA parameters of several adapters
+        auto states = create_states({{-1, N, -1}, {-1, 1, -1}, {-1, -1, K}}, {t4_name, t5_name, t6_name});
+        auto gather_adapter = [&](const ov::Output<ov::Node>& bank) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            return std::make_shared<ov::op::v8::Gather>(bank, param_indices, axis);
+        };
+
+        auto t5810 = std::make_shared<ov::op::v0::MatMul>(param_y, gather_adapter(states.first[2]), false, true);
+        auto t5811 = std::make_shared<ov::op::v1::Multiply>(t5810, gather_adapter(states.first[1]));
+        auto t5812 = std::make_shared<ov::op::v0::MatMul>(t5811, gather_adapter(states.first[0]), false, true);
+
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, t5812);
+
+        auto result_x = std::make_shared<ov::op::v0::Result>(tx);
+        auto result_z = std::make_shared<ov::op::v0::Result>(tz);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector({result_x, result_z}),
+                                               states.second,
+                                               ov::ParameterVector({param_y, param_w, param_indices}));
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        SubgraphBaseTest::generate_inputs(targetInputStaticShapes);
+        // the sequences of an adapter aren't adjacent, the negative index selects the last adapter
+        // and the out of range one selects no adapter
+        const std::vector<int32_t> adapters{1, 1, -1, 1};
+        const auto& param_indices = function->get_parameters()[2];
+        ov::Tensor indices(ov::element::i32, targetInputStaticShapes[2]);
+        auto* data = indices.data<int32_t>();
+        for (size_t i = 0; i < indices.get_size(); i++) {
+            data[i] = i + 1 == indices.get_size() ? -100 : adapters[i % adapters.size()];
+        }
+        inputs[param_indices] = indices;
+    }
+
+    static constexpr size_t K = 64ul;   // Weights matrix K dimension
+    static constexpr size_t N = 128ul;  // Weights matrix N dimension
+};
+
 class LoraPatternConvolutionCPUTest : public LoraPatternBaseCPUTest {
 public:
     void init_function() override {
@@ -290,6 +344,14 @@ TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
 }
 
+TEST_P(LoraPatternMultiAdapterMatmulCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    targetStaticShapes = {{{{5, 7, K}}, {{N, K}}, {{5}}}};
+    run_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+}
+
 TEST_P(LoraPatternConvolutionCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED();
     targetStaticShapes = {{{1, num_channels, 10, 15}}};
@@ -307,6 +369,12 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_MatMul, LoraPatternMatmulCPUTes
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_MultiAdapterMatMul, LoraPatternMultiAdapterMatmulCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(states_precisions),
+                                 ::testing::ValuesIn(states_policies)),
+                         LoraPatternBaseCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPUTest,
                          ::testing::Combine(
                                  ::testing::ValuesIn(states_precisions),
@@ -0,0 +1,167 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+namespace {
+
+// Parameter [?, 16] -> MatMul -> Relu, the batch items are independent
+std::shared_ptr<ov::Model> makeBatchIndependentModel() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto weights = ov::test::utils::make_constant(ov::element::f32, ov::Shape{16, 8});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+    auto relu = std::make_shared<ov::op::v0::Relu>(matmul);
+    return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param}, "BatchIndependent");
+}
+
+// Counts the inferences recorded by the runtime traces of the destroyed requests and removes the traces
+size_t countTracedInferences(const std::string& tracePrefix) {
+    size_t inferences = 0;
+    // the traces are numbered in the order they are created in the process
+    for (size_t i = 0; i < 1024; i++) {
+        const auto path = tracePrefix + "_" + std::to_string(i) + ".json";
+        if (!ov::test::utils::fileExists(path)) {
+            continue;
+        }
+        std::ifstream traceFile(path);
+        const std::string trace((std::istreambuf_iterator<char>(traceFile)), std::istreambuf_iterator<char>());
+        traceFile.close();
+        ov::test::utils::removeFile(path);
+        const std::string inferEvent = "\"name\":\"Infer\"";
+        for (auto pos = trace.find(inferEvent); pos != std::string::npos; pos = trace.find(inferEvent, pos + 1)) {
+            inferences++;
+        }
+    }
+    return inferences;
+}
+
+}  // namespace
+
+TEST(RequestCoalescingTest, smoke_CoalescedRequestsMatchSeparateInferences) {
+    ov::Core core;
+    const auto model = makeBatchIndependentModel();
+    const ov::AnyMap precision{{ov::hint::inference_precision.name(), ov::element::f32}};
+    auto reference = core.compile_model(model, ov::test::utils::DEVICE_CPU, precision);
+
+    // the internal requests inferring the coalesced inputs aren't traced, so the coalesced requests record nothing
+    const std::string tracePrefix = ov::test::utils::generateTestFilePrefix() + "_coalescing_trace";
+    auto config = precision;
+    config.insert({ov::intel_cpu::runtime_trace_path.name(), tracePrefix});
+    config.insert({ov::intel_cpu::coalesce_requests_timeout.name(), 20000U});
+    config.insert({ov::intel_cpu::coalesce_requests_max_batch.name(), size_t{6}});
+    config.insert({ov::num_streams.name(), 1});
+    auto compiled = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+
+    // the last request doesn't fit the maximum batch of the first coalesced inference
+    const std::vector<size_t> batches{1, 2, 1, 3, 1, 2, 6};
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> inputs;
+    for (size_t i = 0; i < batches.size(); i++) {
+        requests.push_back(compiled.create_infer_request());
+        const ov::test::utils::InputGenerateData data(-5, 10, 8, static_cast<int32_t>(i));
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{batches[i], 16}, data));
+        requests.back().set_input_tensor(inputs.back());
+    }
+
+    for (auto& request : requests) {
+        request.start_async();
+    }
+    for (auto& request : requests) {
+        request.wait();
+    }
+
+    auto referenceRequest = reference.create_infer_request();
+    for (size_t i = 0; i < batches.size(); i++) {
+        referenceRequest.set_input_tensor(inputs[i]);
+        referenceRequest.infer();
+        const auto actual = requests[i].get_output_tensor();
+        ASSERT_EQ(ov::Shape({batches[i], 8}), actual.get_shape());
+        ov::test::utils::compare(referenceRequest.get_output_tensor(), actual, 1e-5, 1e-5);
+    }
+
+    // the synchronous inference is never coalesced
+    requests.front().set_input_tensor(inputs[1]);
+    requests.front().infer();
+    referenceRequest.set_input_tensor(inputs[1]);
+    referenceRequest.infer();
+    ov::test::utils::compare(referenceRequest.get_output_tensor(), requests.front().get_output_tensor(), 1e-5, 1e-5);
+
+    // the requests of the first coalesced inference don't infer themselves, the synchronous inference is traced
+    requests.clear();
+    ASSERT_LE(countTracedInferences(tracePrefix), batches.size() - 1);
+}
+
+TEST(RequestCoalescingTest, smoke_CoalescedRequestsWithInputStaging) {
+    // the i64 input is converted to i32 by the plugin, so it can't be shared with the graph and is staged
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, 16});
+    auto add = std::make_shared<ov::op::v1::Add>(param, ov::op::v0::Constant::create(ov::element::i64, {1}, {1}));
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiled = core.compile_model(model,
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::num_streams(1),
+                                       ov::intel_cpu::async_input_staging(true),
+                                       ov::intel_cpu::coalesce_requests_timeout(20000U));
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 3; i++) {
+        requests.push_back(compiled.create_infer_request());
+        requests.back().set_input_tensor(ov::Tensor(ov::element::i64, ov::Shape{i + 1, 16}));
+    }
+    auto fill = [&](int64_t iteration) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto input = requests[i].get_input_tensor();
+            std::iota(input.data<int64_t>(), input.data<int64_t>() + input.get_size(), iteration * 100 + i);
+        }
+    };
+    auto check = [&](size_t i, int64_t iteration) {
+        const auto output = requests[i].get_output_tensor();
+        ASSERT_EQ(output.get_shape(), ov::Shape({i + 1, 16}));
+        for (size_t j = 0; j < output.get_size(); j++) {
+            ASSERT_EQ(output.data<int64_t>()[j], iteration * 100 + static_cast<int64_t>(i + j) + 1);
+        }
+    };
+
+    fill(1);
+    for (auto& request : requests) {
+        request.start_async();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].wait();
+        check(i, 1);
+    }
+
+    // the inputs staged for the coalesced inferences must not be consumed by the synchronous ones
+    fill(2);
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].infer();
+        check(i, 2);
+    }
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+using WeightsPlacementParams = std::tuple<InputShape, ov::intel_cpu::WeightsNumaPlacement>;
+
+// MatMul -> Relu -> MatMul -> Relu -> MatMul with the weights of the next layer prefetched by the execution and
+// spread over the NUMA nodes if the stream spans several nodes
+class WeightsPlacementTest : public testing::WithParamInterface<WeightsPlacementParams>,
+                             virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<WeightsPlacementParams>& obj) {
+        const auto& [inputShape, placement] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_placement=" << placement;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [inputShape, placement] = GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes({inputShape});
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        configuration.insert({ov::intel_cpu::weights_numa_placement.name(), placement});
+        configuration.insert({ov::intel_cpu::weights_prefetch_size.name(), size_t{64 * 1024}});
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        std::shared_ptr<ov::Node> layer = param;
+        size_t inputs = 64;
+        for (const size_t outputs : {256, 128}) {
+            auto weights = ov::test::utils::make_constant(precision, ov::Shape{outputs, inputs});
+            auto matmul = std::make_shared<ov::op::v0::MatMul>(layer, weights, false, true);
+            layer = std::make_shared<ov::op::v0::Relu>(matmul);
+            inputs = outputs;
+        }
+        auto weights = ov::test::utils::make_constant(precision, ov::Shape{128, 16});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(layer, weights);
+
+        function = std::make_shared<ov::Model>(matmul, ov::ParameterVector{param}, "WeightsPlacement");
+    }
+};
+
+TEST_P(WeightsPlacementTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{2, 64}}},
+    {{-1, 64}, {{1, 64}, {5, 64}, {1, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsPlacement,
+                         WeightsPlacementTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE,
+                                                              ov::intel_cpu::WeightsNumaPlacement::PARTITION)),
+                         WeightsPlacementTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+using FCStructuredSparseWeightsParams = std::tuple<InputShape,  // input shape
+                                                   size_t,      // output channels
+                                                   bool,        // transpose_b
+                                                   bool>;       // with bias
+
+// MatMul -> [Add] with f32 weights which have at most 2 nonzero values in each group of 4 input channels
+class FCStructuredSparseWeightsTest : public testing::WithParamInterface<FCStructuredSparseWeightsParams>,
+                                      virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCStructuredSparseWeightsParams>& obj) {
+        const auto& [inputShape, OC, transposeB, withBias] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_OC=" << OC << "_transposeB=" << transposeB << "_bias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    const std::string fcName = "TestedFullyConnected";
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [inputShape, OC, transposeB, withBias] = GetParam();
+        init_input_shapes({inputShape});
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        configuration.insert({ov::intel_cpu::fc_structured_sparse_weights.name(), true});
+
+        const size_t IC = inputShape.first.rbegin()->get_length();
+        std::vector<float> weights(OC * IC, 0.F);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t ic = 0; ic < IC; ic += 4) {
+                // the positions of the nonzero values vary, some groups keep a single one
+                const size_t first = (oc + ic / 4) % 4;
+                const size_t second = (first + 1 + oc % 3) % 4;
+                const size_t idx0 = transposeB ? oc * IC + ic + first : (ic + first) * OC + oc;
+                const size_t idx1 = transposeB ? oc * IC + ic + second : (ic + second) * OC + oc;
+                weights[idx0] = 0.1F * static_cast<float>((oc + ic) % 7) - 0.3F;
+                weights[idx1] = (oc + ic) % 5 == 0 ? 0.F : 0.05F * static_cast<float>((oc * 3 + ic) % 11) - 0.25F;
+            }
+        }
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        const auto weightsShape = transposeB ? ov::Shape{OC, IC} : ov::Shape{IC, OC};
+        auto weightsConst = ov::op::v0::Constant::create(ov::element::f32, weightsShape, weights);
+        std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v0::MatMul>(param, weightsConst, false, transposeB);
+        result->set_friendly_name(fcName);
+        if (withBias) {
+            std::vector<float> bias(OC);
+            for (size_t oc = 0; oc < OC; oc++) {
+                bias[oc] = 0.01F * static_cast<float>(oc % 13);
+            }
+            auto biasConst = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, OC}, bias);
+            result = std::make_shared<ov::op::v1::Add>(result, biasConst);
+        }
+        function = std::make_shared<ov::Model>(result, ov::ParameterVector{param}, "FCStructuredSparseWeights");
+    }
+
+    void check_sparse_implementation() {
+        const auto runtimeModel = compiledModel.get_runtime_model();
+        bool found = false;
+        for (const auto& node : runtimeModel->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "FullyConnected") {
+                continue;
+            }
+            const auto implType = rtInfo.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            const auto expectedType = ov::with_cpu_x86_avx512_core() ? "jit_sparse_avx512" : "jit_sparse_avx2";
+            ASSERT_EQ(implType, expectedType);
+            found = true;
+        }
+        ASSERT_TRUE(found);
+    }
+};
+
+TEST_P(FCStructuredSparseWeightsTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP();
+    }
+    run();
+    check_sparse_implementation();
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{5, 64}}},
+    {{-1, -1, 64}, {{1, 1, 64}, {2, 9, 64}, {1, 3, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCStructuredSparseWeights,
+                         FCStructuredSparseWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(16, 37),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false)),
+                         FCStructuredSparseWeightsTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "common_test_utils/subgraph_builders/weights_decompression_builders.hpp"
+#include "internal_properties.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "shared_test_classes/subgraph/moe_builders.hpp"
 #include "shared_test_classes/subgraph/weights_decompression_params.hpp"
@@ -284,6 +285,12 @@ const std::vector<MoePatternParams> moe_params_smoke = {
         4,                                                           // number_of_experts
         256                                                          // intermediate_size
     },
+    {
+        {{-1, -1, 64}, {{1, 40, 64}, {1, 1, 64}, {1, 7, 64}}},  // many experts hit by a few tokens each
+        2,                                                      // topk
+        32,                                                     // number_of_experts
+        128                                                     // intermediate_size
+    },
 };
 
 std::vector<ov::AnyMap> generate_additional_config() {
@@ -294,6 +301,15 @@ std::vector<ov::AnyMap> generate_additional_config() {
     return additional_config;
 }
 
+// the experts weights are repacked on demand into a cache smaller than the number of experts
+std::vector<ov::AnyMap> generate_experts_cache_config() {
+    auto additional_config = generate_additional_config();
+    for (auto& config : additional_config) {
+        config.insert(ov::intel_cpu::moe_experts_cache_size(2));
+    }
+    return additional_config;
+}
+
 }  // namespace
 
 INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_basic,
@@ -324,4 +340,19 @@ INSTANTIATE_TEST_SUITE_P(smoke_MoeCompressedWeights,
                                             ::testing::Values(true)),  // use_matmul_decompression_impl
                          MoECompressedWeightsSubgraphTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_MoeCompressedWeights_ExpertsCache,
+                         MoECompressedWeightsSubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_smoke),
+                                            ::testing::Values(MoEType::MoE3GeMM),
+                                            ::testing::Values(ov::element::u8, ov::element::u4),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full),
+                                            ::testing::Values(false),  // reshape on decompression
+                                            ::testing::Values(16),     // decompression group size
+                                            ::testing::ValuesIn(generate_experts_cache_config()),
+                                            ::testing::Values(true)),  // use_matmul_decompression_impl
+                         MoECompressedWeightsSubgraphTest::getTestCaseName);
+
 }  // namespace ov::test
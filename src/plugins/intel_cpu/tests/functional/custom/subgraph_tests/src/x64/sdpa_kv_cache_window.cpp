@@ -0,0 +1,335 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_assertions.hpp"
+#include "internal_properties.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/internal_properties.hpp"
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+namespace ov {
+namespace test {
+namespace {
+
+constexpr size_t heads = 4;
+constexpr size_t head_size = 32;
+
+// q, k, v [B, H, L, S] and the mask [B, 1, L1, L0 + L1] of all the session tokens, the KV cache is the state
+std::shared_ptr<ov::Model> make_stateful_sdpa_model() {
+    const ov::PartialShape qkv_shape{-1, heads, -1, head_size};
+    auto q = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, qkv_shape);
+    auto k = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, qkv_shape);
+    auto v = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, qkv_shape);
+    auto mask = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 1, -1, -1});
+    auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto axis = ov::op::v0::Constant::create(ov::element::i32, {1}, {0});
+
+    ov::OutputVector present;
+    ov::SinkVector assigns;
+    for (const auto& [name, cur] : {std::make_pair("pastk", k), std::make_pair("pastv", v)}) {
+        auto var = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{qkv_shape, ov::element::f32, name});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(var);
+        auto gather = std::make_shared<ov::op::v8::Gather>(past, beam_idx, axis);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather, cur}, 2);
+        assigns.push_back(std::make_shared<ov::op::v6::Assign>(concat, var));
+        present.push_back(concat);
+    }
+    auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q, present[0], present[1], mask, false);
+    return std::make_shared<ov::Model>(ov::OutputVector{sdpa},
+                                       assigns,
+                                       ov::ParameterVector{q, k, v, mask, beam_idx});
+}
+
+ov::Tensor make_input(size_t length, float start) {
+    ov::Tensor tensor(ov::element::f32, {1, heads, length, head_size});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = start + 0.001f * static_cast<float>(i % 97);
+    }
+    return tensor;
+}
+
+// q, k and v of the step of the session
+std::array<ov::Tensor, 3> make_step_inputs(size_t step, size_t length) {
+    return {make_input(length, 0.1f * static_cast<float>(step % 7)),
+            make_input(length, 0.2f * static_cast<float>(step % 5)),
+            make_input(length, 0.3f * static_cast<float>(step % 3))};
+}
+
+size_t step_length(size_t step, size_t prompt) {
+    return step == 0 ? prompt : 1;
+}
+
+// runs the prompt and the generated tokens one by one, returns the outputs of the steps and the final key cache
+std::pair<std::vector<ov::Tensor>, ov::Tensor> run_session(ov::InferRequest& request,
+                                                           size_t prompt,
+                                                           size_t generated,
+                                                           const std::function<void()>& after_step = {}) {
+    std::vector<ov::Tensor> outputs;
+    size_t total = 0;
+    for (size_t step = 0; step <= generated; step++) {
+        const size_t length = step_length(step, prompt);
+        total += length;
+        ov::Tensor mask(ov::element::f32, {1, 1, length, total});
+        std::memset(mask.data(), 0, mask.get_byte_size());
+        ov::Tensor beam_idx(ov::element::i32, {1});
+        beam_idx.data<int32_t>()[0] = 0;
+        const auto qkv = make_step_inputs(step, length);
+        for (size_t i = 0; i < qkv.size(); i++) {
+            request.set_input_tensor(i, qkv[i]);
+        }
+        request.set_input_tensor(3, mask);
+        request.set_input_tensor(4, beam_idx);
+        request.infer();
+        const auto& output = request.get_output_tensor(0);
+        ov::Tensor copy(output.get_element_type(), output.get_shape());
+        output.copy_to(copy);
+        outputs.push_back(copy);
+        if (after_step) {
+            after_step();
+        }
+    }
+    for (auto&& state : request.query_state()) {
+        if (state.get_name() == "pastk") {
+            const auto& cache = state.get_state();
+            ov::Tensor copy(cache.get_element_type(), cache.get_shape());
+            cache.copy_to(copy);
+            return {outputs, copy};
+        }
+    }
+    OPENVINO_THROW("Failed to find the key cache state");
+}
+
+// the outputs of the steps attending to the sink tokens and the recent tokens kept by the sliding window,
+// the tokens are evicted after the step once the cache exceeds the sinks and the window by a chunk
+std::vector<ov::Tensor> run_reference_session(size_t prompt, size_t generated, size_t window, size_t sinks) {
+    const size_t chunk = std::max<size_t>(window / 8, 1);
+    std::vector<std::vector<float>> keys;
+    std::vector<std::vector<float>> values;
+    std::vector<size_t> kept;
+    std::vector<ov::Tensor> outputs;
+    for (size_t step = 0; step <= generated; step++) {
+        const size_t length = step_length(step, prompt);
+        const auto [q, k, v] = make_step_inputs(step, length);
+        for (size_t l = 0; l < length; l++) {
+            keys.emplace_back(heads * head_size);
+            values.emplace_back(heads * head_size);
+            for (size_t h = 0; h < heads; h++) {
+                const size_t offset = (h * length + l) * head_size;
+                std::copy_n(k.data<float>() + offset, head_size, keys.back().data() + h * head_size);
+                std::copy_n(v.data<float>() + offset, head_size, values.back().data() + h * head_size);
+            }
+            kept.push_back(keys.size() - 1);
+        }
+
+        ov::Tensor output(ov::element::f32, {1, heads, length, head_size});
+        for (size_t h = 0; h < heads; h++) {
+            for (size_t l = 0; l < length; l++) {
+                const float* query = q.data<float>() + (h * length + l) * head_size;
+                std::vector<double> weights(kept.size());
+                for (size_t j = 0; j < kept.size(); j++) {
+                    const float* key = keys[kept[j]].data() + h * head_size;
+                    weights[j] = std::inner_product(query, query + head_size, key, 0.0) / std::sqrt(head_size);
+                }
+                const double max_weight = *std::max_element(weights.begin(), weights.end());
+                double sum = 0.0;
+                for (auto& weight : weights) {
+                    weight = std::exp(weight - max_weight);
+                    sum += weight;
+                }
+                float* out = output.data<float>() + (h * length + l) * head_size;
+                for (size_t s = 0; s < head_size; s++) {
+                    double acc = 0.0;
+                    for (size_t j = 0; j < kept.size(); j++) {
+                        acc += weights[j] * values[kept[j]][h * head_size + s];
+                    }
+                    out[s] = static_cast<float>(acc / sum);
+                }
+            }
+        }
+        outputs.push_back(output);
+
+        if (kept.size() >= sinks + window + chunk) {
+            kept.erase(kept.begin() + sinks, kept.end() - window);
+        }
+    }
+    return outputs;
+}
+
+class SDPAKVCacheWindowTest : public testing::TestWithParam<ov::element::Type> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ov::element::Type>& obj) {
+        return "kv_cache_precision=" + obj.param.get_type_name();
+    }
+};
+
+TEST_P(SDPAKVCacheWindowTest, EvictsTheMiddleTokens) {
+    constexpr size_t window = 16;
+    constexpr size_t sinks = 4;
+    constexpr size_t prompt = 10;
+    constexpr size_t generated = 40;
+    const auto kv_cache_precision = GetParam();
+    ov::Core core;
+    const ov::AnyMap common{ov::hint::inference_precision(ov::element::f32),
+                            ov::hint::kv_cache_precision(kv_cache_precision)};
+
+    auto full_request = core.compile_model(make_stateful_sdpa_model(), "CPU", common).create_infer_request();
+    auto window_config = common;
+    window_config[ov::intel_cpu::kv_cache_window_size.name()] = window;
+    window_config[ov::intel_cpu::kv_cache_sink_tokens.name()] = sinks;
+    auto window_request = core.compile_model(make_stateful_sdpa_model(), "CPU", window_config).create_infer_request();
+
+    const auto [full_outputs, full_cache] = run_session(full_request, prompt, generated);
+    const auto [window_outputs, window_cache] = run_session(window_request, prompt, generated);
+
+    // the cache is bounded by the sinks, the window and the chunk of the amortized eviction
+    const size_t full_length = full_cache.get_shape()[2];
+    const size_t window_length = window_cache.get_shape()[2];
+    ASSERT_EQ(full_length, prompt + generated);
+    ASSERT_GE(window_length, sinks + window);
+    ASSERT_LT(window_length, sinks + window + window / 8);
+
+    // the cache keeps the sink tokens and the most recent tokens of the session, the u8 cache is read dequantized,
+    // so the by-token scales and zero points are moved together with the tokens
+    ASSERT_EQ(full_cache.get_element_type(), window_cache.get_element_type());
+    const size_t token_bytes = head_size * full_cache.get_element_type().size();
+    for (size_t h = 0; h < heads; h++) {
+        const auto* full = static_cast<const uint8_t*>(full_cache.data()) + h * full_length * token_bytes;
+        const auto* kept = static_cast<const uint8_t*>(window_cache.data()) + h * window_length * token_bytes;
+        for (size_t l = 0; l < window_length; l++) {
+            const size_t source = l < sinks ? l : full_length - window_length + l;
+            ASSERT_EQ(std::memcmp(kept + l * token_bytes, full + source * token_bytes, token_bytes), 0)
+                << "head " << h << " token " << l;
+        }
+    }
+
+    // the outputs are equal until the first eviction
+    for (size_t step = 0; prompt + step <= sinks + window + window / 8; step++) {
+        const auto bytes = full_outputs[step].get_byte_size();
+        ASSERT_EQ(std::memcmp(full_outputs[step].data(), window_outputs[step].data(), bytes), 0) << "step " << step;
+    }
+
+    // and after the evictions they are the attention over the kept tokens
+    const auto reference_outputs = run_reference_session(prompt, generated, window, sinks);
+    const double threshold = kv_cache_precision == ov::element::u8 ? 1e-2 : 1e-4;
+    for (size_t step = 0; step < reference_outputs.size(); step++) {
+        SCOPED_TRACE("step " + std::to_string(step));
+        ov::test::utils::compare(reference_outputs[step], window_outputs[step], threshold, threshold);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPAKVCacheWindow,
+                         SDPAKVCacheWindowTest,
+                         ::testing::Values(ov::element::f32, ov::element::u8),
+                         SDPAKVCacheWindowTest::getTestCaseName);
+
+TEST(smoke_SDPAKVCacheWindow, ByChannelQuantizationIsNotSupported) {
+    ov::Core core;
+    const ov::AnyMap config{ov::hint::inference_precision(ov::element::f32),
+                            ov::hint::kv_cache_precision(ov::element::u8),
+                            {ov::internal::key_cache_quant_mode.name(), ov::internal::CacheQuantMode::BY_CHANNEL},
+                            {ov::intel_cpu::kv_cache_window_size.name(), size_t{16}}};
+    OV_EXPECT_THROW(core.compile_model(make_stateful_sdpa_model(), "CPU", config),
+                    ov::Exception,
+                    testing::HasSubstr("sliding window"));
+}
+
+#if defined(__linux__)
+// writes the pages of the KV cache spill files mapped by the process back to the files and drops them, so the next
+// steps reload the cache by the page faults. Returns the number of the mapped spill files
+size_t page_out_spill_files(const std::string& directory) {
+    std::ifstream maps("/proc/self/maps");
+    size_t mappings = 0;
+    std::string line;
+    while (std::getline(maps, line)) {
+        std::istringstream fields(line);
+        std::string range, perms, offset, device, inode, path;
+        fields >> range >> perms >> offset >> device >> inode;
+        std::getline(fields >> std::ws, path);
+        if (path.rfind(directory + "/", 0) != 0) {
+            continue;
+        }
+        const auto dash = range.find('-');
+        const auto begin = std::stoull(range.substr(0, dash), nullptr, 16);
+        const auto end = std::stoull(range.substr(dash + 1), nullptr, 16);
+#    if defined(MADV_PAGEOUT)
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_PAGEOUT);
+#    else
+        // the pages are written back by the file system and only dropped if they are clean
+        msync(reinterpret_cast<void*>(begin), end - begin, MS_SYNC);
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+#    endif
+        mappings++;
+    }
+    return mappings;
+}
+
+TEST(smoke_SDPAKVCacheSpill, SpilledCacheIsReloaded) {
+    constexpr size_t prompt = 10;
+    constexpr size_t generated = 40;
+    const auto directory = ov::test::utils::getCurrentWorkingDir() + "/" +
+                           ov::test::utils::generateTestFilePrefix() + "_kv_cache_spill";
+    ov::test::utils::createDirectory(directory);
+
+    ov::Core core;
+    const ov::AnyMap common{ov::hint::inference_precision(ov::element::f32),
+                            ov::hint::kv_cache_precision(ov::element::f32)};
+    auto memory_request = core.compile_model(make_stateful_sdpa_model(), "CPU", common).create_infer_request();
+    auto spill_config = common;
+    spill_config[ov::intel_cpu::kv_cache_spill_dir.name()] = directory;
+    spill_config[ov::intel_cpu::kv_cache_hot_window.name()] = size_t{4};
+    auto spill_request = core.compile_model(make_stateful_sdpa_model(), "CPU", spill_config).create_infer_request();
+
+    const auto [memory_outputs, memory_cache] = run_session(memory_request, prompt, generated);
+    size_t mappings = 0;
+    const auto [spill_outputs, spill_cache] = run_session(spill_request, prompt, generated, [&] {
+        mappings = std::max(mappings, page_out_spill_files(directory));
+    });
+    ov::test::utils::removeDir(directory);
+
+    // the key and the value caches are backed by the spill files
+    ASSERT_GE(mappings, 2U);
+    ASSERT_EQ(memory_cache.get_shape(), spill_cache.get_shape());
+    ASSERT_EQ(std::memcmp(memory_cache.data(), spill_cache.data(), memory_cache.get_byte_size()), 0);
+    for (size_t step = 0; step < memory_outputs.size(); step++) {
+        const auto bytes = memory_outputs[step].get_byte_size();
+        ASSERT_EQ(std::memcmp(memory_outputs[step].data(), spill_outputs[step].data(), bytes), 0) << "step " << step;
+    }
+}
+#endif
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+using WeightsCompressionModeParams = std::tuple<ov::intel_cpu::WeightsCompressionMode,  // compression mode
+                                                size_t>;                                // group size
+
+// MatMul with f32 weights compressed by the plugin at the model compilation
+class WeightsCompressionModeTest : public testing::WithParamInterface<WeightsCompressionModeParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<WeightsCompressionModeParams>& obj) {
+        const auto& [mode, groupSize] = obj.param;
+        std::ostringstream result;
+        result << "mode=" << mode << "_groupSize=" << groupSize;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t IC = 64;
+    static constexpr size_t OC = 48;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [mode, groupSize] = GetParam();
+        init_input_shapes({{{-1, -1, IC}, {{1, 1, IC}, {2, 7, IC}}}});
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        configuration.insert({ov::intel_cpu::weights_compression_mode.name(), mode});
+        configuration.insert({ov::intel_cpu::weights_compression_group_size.name(), groupSize});
+
+        const bool int4 = mode == ov::intel_cpu::WeightsCompressionMode::INT4_SYM ||
+                          mode == ov::intel_cpu::WeightsCompressionMode::INT4_ASYM;
+        // the reference runs the original weights, the difference is the quantization error
+        abs_threshold = int4 ? 0.25 : 0.03;
+        rel_threshold = int4 ? 0.1 : 0.01;
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        const auto weights = ov::test::utils::create_and_fill_tensor_real_distribution(ov::element::f32,
+                                                                                        ov::Shape{OC, IC},
+                                                                                        -0.5F,
+                                                                                        0.5F,
+                                                                                        1);
+        auto weightsConst = std::make_shared<ov::op::v0::Constant>(weights);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weightsConst, false, true);
+        function = std::make_shared<ov::Model>(matMul, ov::ParameterVector{param}, "WeightsCompressionMode");
+    }
+
+    ov::element::Type expected_weights_precision() const {
+        switch (std::get<0>(GetParam())) {
+        case ov::intel_cpu::WeightsCompressionMode::INT8_SYM:
+            return ov::element::i8;
+        case ov::intel_cpu::WeightsCompressionMode::INT8_ASYM:
+            return ov::element::u8;
+        case ov::intel_cpu::WeightsCompressionMode::INT4_SYM:
+            return ov::element::i4;
+        case ov::intel_cpu::WeightsCompressionMode::INT4_ASYM:
+            return ov::element::u4;
+        default:
+            return ov::element::f32;
+        }
+    }
+
+    static void check_compressed_fc(const ov::CompiledModel& model, const ov::element::Type& weightsPrecision) {
+        size_t fcCount = 0;
+        for (const auto& node : model.get_runtime_model()->get_ops()) {
+            if (node->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "FullyConnected") {
+                continue;
+            }
+            EXPECT_EQ(node->get_input_element_type(1), weightsPrecision);
+            fcCount++;
+        }
+        ASSERT_EQ(fcCount, 1u);
+    }
+
+    // The exported model keeps the compressed weights, it is imported without the compression properties, as it is
+    // loaded from the model cache
+    void check_export_import() {
+        std::stringstream stream;
+        compiledModel.export_model(stream);
+        auto importedModel =
+            core->import_model(stream, targetDevice, {ov::hint::inference_precision(ov::element::f32)});
+        check_compressed_fc(importedModel, expected_weights_precision());
+
+        auto importedRequest = importedModel.create_infer_request();
+        for (const auto& input : inputs) {
+            importedRequest.set_tensor(input.first, input.second);
+        }
+        importedRequest.infer();
+        ov::test::utils::compare(inferRequest.get_output_tensor(0),
+                                 importedRequest.get_output_tensor(0),
+                                 ov::element::f32,
+                                 1e-6,
+                                 1e-6);
+    }
+};
+
+TEST_P(WeightsCompressionModeTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP();
+    }
+    run();
+    check_compressed_fc(compiledModel, expected_weights_precision());
+    check_export_import();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsCompressionMode,
+                         WeightsCompressionModeTest,
+                         ::testing::Combine(::testing::Values(ov::intel_cpu::WeightsCompressionMode::INT8_SYM,
+                                                              ov::intel_cpu::WeightsCompressionMode::INT8_ASYM,
+                                                              ov::intel_cpu::WeightsCompressionMode::INT4_SYM,
+                                                              ov::intel_cpu::WeightsCompressionMode::INT4_ASYM),
+                                            ::testing::Values(0, 32)),
+                         WeightsCompressionModeTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -156,5 +156,29 @@ INSTANTIATE_TEST_SUITE_P(smoke_Model_Distribution_MatMul_BothTranspose, MatMulLa
                 ::testing::Values(model_distribution_config)),
         MatMulLayerTest::getTestCaseName);
 
+// the output is computed and exchanged by the sub-streams in chunks of the outermost non-unit dimension
+std::vector<std::vector<ov::Shape>> input_shapes_chunked_static {
+    { {4, 5, 6}, {6, 3} },
+    { {9, 9, 9}, {9, 9} },
+    { {1, 16, 8}, {8, 4} },
+};
+
+std::map<std::string, std::string> model_distribution_chunked_config = {
+    {ov::hint::model_distribution_policy.name(), "TENSOR_PARALLEL"},
+    {ov::intel_cpu::enable_tensor_parallel.name(), "true"},
+    {ov::intel_cpu::tensor_parallel_chunk_rows.name(), "2"},
+    {ov::num_streams.name(), "1"},
+    {ov::inference_num_threads.name(), "1"}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Model_Distribution_MatMul_Chunked, MatMulLayerTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(ov::test::static_shapes_to_test_representation(input_shapes_chunked_static)),
+                ::testing::Values(std::make_pair(false, false)),
+                ::testing::ValuesIn(model_types),
+                ::testing::Values(InputLayerType::CONSTANT),
+                ::testing::Values(ov::test::utils::DEVICE_CPU),
+                ::testing::Values(model_distribution_chunked_config)),
+        MatMulLayerTest::getTestCaseName);
+
 } // namespace
 
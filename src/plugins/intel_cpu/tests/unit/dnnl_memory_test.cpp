@@ -7,9 +7,10 @@
 #include <atomic>
 #include <thread>
 
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_assertions.hpp"
 #include "cpu_memory.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
-#include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
 
@@ -102,3 +103,28 @@ TEST(StaticMemoryTest, UnsupportedDnnlPrecision) {
     ASSERT_THROW(dnnl_memory = testMemory->getPrimitive(), ov::Exception);
     ASSERT_FALSE(dnnl_memory);
 }
+
+#if defined(__linux__)
+TEST(FileBackedMemoryTest, KeepsDataAndCantGrow) {
+    const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{64, 1024});
+    auto block = std::make_shared<FileBackedMemoryBlock>(ov::test::utils::getCurrentWorkingDir());
+    Memory memory(eng, desc, block);
+    ASSERT_EQ(memory.getData(), block->getRawPtr());
+
+    auto* data = memory.getDataAs<float>();
+    for (size_t i = 0; i < desc->getShape().getElementsCount(); ++i) {
+        data[i] = static_cast<float>(i);
+    }
+    // the cold pages are read back on the next access
+    OV_ASSERT_NO_THROW(block->markCold(0, memory.getSize()));
+    for (size_t i = 0; i < desc->getShape().getElementsCount(); ++i) {
+        ASSERT_EQ(static_cast<float>(i), data[i]);
+    }
+
+    OV_ASSERT_NO_THROW(memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{32, 1024})));
+    ASSERT_EQ(memory.getData(), block->getRawPtr());
+    ASSERT_THROW(memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{128, 1024})),
+                 ov::Exception);
+}
+#endif
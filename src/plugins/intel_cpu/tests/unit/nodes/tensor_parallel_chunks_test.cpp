@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "nodes/common/tensor_parallel_chunks.h"
+#include "sub_memory_manager.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t rows = 10;
+// the output channels of the sub-streams, the last one gets the remainder
+const std::vector<int> channels = {3, 3, 4};
+constexpr size_t outputChannels = 10;
+
+float expectedValue(size_t row, size_t channel) {
+    return static_cast<float>(row * 100 + channel);
+}
+
+// the output slices computed by the sub-streams
+std::vector<std::vector<float>> makeSlices() {
+    std::vector<std::vector<float>> slices;
+    size_t firstChannel = 0;
+    for (const auto sliceChannels : channels) {
+        std::vector<float> slice;
+        for (size_t row = 0; row < rows; row++) {
+            for (int c = 0; c < sliceChannels; c++) {
+                slice.push_back(expectedValue(row, firstChannel + c));
+            }
+        }
+        slices.push_back(std::move(slice));
+        firstChannel += sliceChannels;
+    }
+    return slices;
+}
+
+void checkGatheredRows(const std::vector<float>& dst, const std::vector<size_t>& gatheredRows) {
+    size_t firstChannel = 0;
+    for (size_t idx = 0; idx < channels.size(); idx++) {
+        for (size_t row = 0; row < rows; row++) {
+            for (int c = 0; c < channels[idx]; c++) {
+                const auto channel = firstChannel + c;
+                const auto expected = row < gatheredRows[idx] ? expectedValue(row, channel) : -1.0F;
+                ASSERT_EQ(dst[row * outputChannels + channel], expected)
+                    << "sub-stream: " << idx << " row: " << row << " channel: " << channel;
+            }
+        }
+        firstChannel += channels[idx];
+    }
+}
+
+}  // namespace
+
+TEST(TensorParallelChunksTest, FewRowsAreNotChunked) {
+    ASSERT_TRUE(TensorParallelChunks::create({1, 1, 64}, 16).empty());
+    ASSERT_TRUE(TensorParallelChunks::create({1, 16, 64}, 16).empty());
+    ASSERT_TRUE(TensorParallelChunks::create({1, 128, 64}, 0).empty());
+    ASSERT_TRUE(TensorParallelChunks::create({64}, 16).empty());
+}
+
+TEST(TensorParallelChunksTest, OutermostNonUnitDimIsChunked) {
+    const auto tokens = TensorParallelChunks::create({1, 100, 64}, 32);
+    ASSERT_FALSE(tokens.empty());
+    ASSERT_EQ(tokens.dim, 1U);
+    ASSERT_EQ(tokens.units, 100U);
+    ASSERT_EQ(tokens.unitRows, 1U);
+    ASSERT_EQ(tokens.chunkUnits, 32U);
+    ASSERT_EQ(tokens.tailUnits(), 4U);
+    ASSERT_EQ(tokens.rows(), 100U);
+
+    const auto batches = TensorParallelChunks::create({4, 10, 64}, 25);
+    ASSERT_EQ(batches.dim, 0U);
+    ASSERT_EQ(batches.unitRows, 10U);
+    ASSERT_EQ(batches.chunkUnits, 2U);
+    ASSERT_EQ(batches.tailUnits(), 0U);
+    ASSERT_EQ(batches.rows(), 40U);
+
+    // a chunk has at least a single index of the chunked dimension
+    const auto largeUnits = TensorParallelChunks::create({4, 10, 64}, 5);
+    ASSERT_EQ(largeUnits.chunkUnits, 1U);
+    ASSERT_EQ(largeUnits.tailUnits(), 0U);
+}
+
+TEST(TensorParallelGatherTest, GathersPublishedRows) {
+    const auto slices = makeSlices();
+    SubMemoryManager subMemory(static_cast<int>(channels.size()));
+    auto& memorys = subMemory._memorys_table[0];
+    auto& readyRows = subMemory._ready_rows[0];
+    for (size_t idx = 0; idx < channels.size(); idx++) {
+        memorys[idx].send_buf = const_cast<float*>(slices[idx].data());
+    }
+    const CpuParallel cpuParallel(TbbPartitioner::STATIC);
+    std::vector<float> dst(rows * outputChannels, -1.0F);
+    TensorParallelGather gather(rows, channels, sizeof(float));
+    auto* dstData = reinterpret_cast<uint8_t*>(dst.data());
+
+    ASSERT_FALSE(gather.gather(dstData, memorys, readyRows, cpuParallel));
+    checkGatheredRows(dst, {0, 0, 0});
+
+    readyRows[0].store(4);
+    readyRows[2].store(2);
+    ASSERT_FALSE(gather.gather(dstData, memorys, readyRows, cpuParallel));
+    checkGatheredRows(dst, {4, 0, 2});
+
+    readyRows[0].store(rows);
+    readyRows[1].store(7);
+    ASSERT_FALSE(gather.gather(dstData, memorys, readyRows, cpuParallel));
+    checkGatheredRows(dst, {rows, 7, 2});
+
+    readyRows[1].store(rows);
+    readyRows[2].store(rows);
+    ASSERT_TRUE(gather.gather(dstData, memorys, readyRows, cpuParallel));
+    checkGatheredRows(dst, {rows, rows, rows});
+}
+
+// the sub-streams publish their slices chunk by chunk and gather the chunks of the others concurrently
+TEST(TensorParallelGatherTest, SubStreamsGatherConcurrently) {
+    const auto slices = makeSlices();
+    SubMemoryManager subMemory(static_cast<int>(channels.size()));
+    auto& memorys = subMemory._memorys_table[0];
+    auto& readyRows = subMemory._ready_rows[0];
+    for (size_t idx = 0; idx < channels.size(); idx++) {
+        memorys[idx].send_buf = const_cast<float*>(slices[idx].data());
+    }
+    const CpuParallel cpuParallel(TbbPartitioner::STATIC);
+    constexpr size_t chunkRows = 3;
+
+    std::vector<std::vector<float>> dsts(channels.size(), std::vector<float>(rows * outputChannels, -1.0F));
+    std::vector<std::thread> subStreams;
+    for (size_t rank = 0; rank < channels.size(); rank++) {
+        subStreams.emplace_back([&, rank]() {
+            TensorParallelGather gather(rows, channels, sizeof(float));
+            auto* dstData = reinterpret_cast<uint8_t*>(dsts[rank].data());
+            for (size_t row = 0; row < rows; row += chunkRows) {
+                readyRows[rank].store(std::min(row + chunkRows, rows), std::memory_order_release);
+                gather.gather(dstData, memorys, readyRows, cpuParallel);
+            }
+            while (!gather.gather(dstData, memorys, readyRows, cpuParallel)) {
+            }
+        });
+    }
+    for (auto& subStream : subStreams) {
+        subStream.join();
+    }
+    for (const auto& dst : dsts) {
+        checkGatheredRows(dst, {rows, rows, rows});
+    }
+}
@@ -113,6 +113,32 @@ public:
     }
 };
 
+class BrgemmCPUCacheAwareBlockingTest : public BrgemmBlockingTest {
+public:
+    void SetUp() override {
+        pipeline.register_pass<ov::intel_cpu::pass::BrgemmCPUBlocking>(cache_sizes);
+    }
+
+protected:
+    ov::intel_cpu::pass::BrgemmCPUBlocking::CacheSizes cache_sizes;
+};
+
+class BrgemmCPUSmallL2BlockingTest : public BrgemmCPUCacheAwareBlockingTest {
+public:
+    BrgemmCPUSmallL2BlockingTest() {
+        cache_sizes.l1 = 32 * 1024;
+        cache_sizes.l2 = 256 * 1024;
+    }
+};
+
+class BrgemmCPULargeL2BlockingTest : public BrgemmCPUCacheAwareBlockingTest {
+public:
+    BrgemmCPULargeL2BlockingTest() {
+        cache_sizes.l1 = 48 * 1024;
+        cache_sizes.l2 = 2 * 1024 * 1024;
+    }
+};
+
 TEST_F(BrgemmCPUBlockingTest, Floating) {
     const ov::PartialShape input_shape_a{1, 384, 16, 1024};
     const ov::PartialShape input_shape_b{1, 384, 16, 1024};
@@ -223,6 +249,66 @@ TEST_F(BrgemmCPUBlockingTest, Floating_LargeK) {
     }
 }
 
+TEST_F(BrgemmCPUSmallL2BlockingTest, Floating) {
+    const ov::Dimension::value_type m = 384;
+    const ov::Dimension::value_type n = 384;
+    const ov::Dimension::value_type k = 1024;
+    const ov::PartialShape input_shape_a{1, 16, m, k};
+    const ov::PartialShape input_shape_b{1, 16, k, n};
+    const auto precision = ov::element::f32;
+    const BrgemmConfig brgemm_config(x64::cpu_isa_t::avx512_core, precision, precision, precision, false, false);
+    // the blocks are reduced to fit the half of L2
+    k_blk = 256;
+
+    {
+        auto data_a = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second}, brgemm_config);
+        init_expr_descriptors(*brgemm.first, {});
+        auto result = linear_ir->push_node<ov::opset10::Result>(brgemm.second);
+    }
+    {
+        auto data_a = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir_ref->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second}, brgemm_config);
+        const auto& brgemm_expr = *brgemm.first;
+        init_expr_descriptors(brgemm_expr, {{m_blk, k_blk}, {k_blk, n_blk}, {m_blk, n_blk}});
+        create_brgemm_loop_infos(linear_ir_ref, brgemm_expr, m, m_blk, k, k_blk, n, n_blk);
+        brgemm_expr->set_loop_ids({2, 1, 0});
+        auto result = linear_ir_ref->push_node<ov::opset10::Result>(brgemm.second);
+    }
+}
+
+TEST_F(BrgemmCPULargeL2BlockingTest, Floating) {
+    const ov::Dimension::value_type m = 384;
+    const ov::Dimension::value_type n = 384;
+    const ov::Dimension::value_type k = 1024;
+    const ov::PartialShape input_shape_a{1, 16, m, k};
+    const ov::PartialShape input_shape_b{1, 16, k, n};
+    const auto precision = ov::element::f32;
+    const BrgemmConfig brgemm_config(x64::cpu_isa_t::avx512_core, precision, precision, precision, false, false);
+    // the whole K fits L2, so the rows panel of A is reused by all the N blocks, and larger M blocks reduce B reloads
+    m_blk = 128;
+
+    {
+        auto data_a = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second}, brgemm_config);
+        init_expr_descriptors(*brgemm.first, {});
+        auto result = linear_ir->push_node<ov::opset10::Result>(brgemm.second);
+    }
+    {
+        auto data_a = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir_ref->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second}, brgemm_config);
+        const auto& brgemm_expr = *brgemm.first;
+        init_expr_descriptors(brgemm_expr, {{m_blk, full_dim}, {full_dim, n_blk}, {m_blk, n_blk}});
+        create_brgemm_loop_infos(linear_ir_ref, brgemm_expr, m, m_blk, k, 0, n, n_blk);
+        brgemm_expr->set_loop_ids({1, 0});
+        auto result = linear_ir_ref->push_node<ov::opset10::Result>(brgemm.second);
+    }
+}
+
 TEST_F(BrgemmCPUBlockingTest, Float_FC) {
     const ov::Dimension::value_type m = 384;
     const ov::Dimension::value_type k = 1024;
@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <transformations/cpu_opset/common/pass/compress_matmul_weights.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <openvino/core/model.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+// weights type, group size, transpose_b
+using CompressMatMulWeightsParams = std::tuple<ov::element::Type, size_t, bool>;
+
+class CompressMatMulWeightsTest : public testing::WithParamInterface<CompressMatMulWeightsParams>,
+                                  public ::testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CompressMatMulWeightsParams>& obj) {
+        const auto& [weights_type, group_size, transpose_b] = obj.param;
+        std::ostringstream result;
+        result << "weights_type=" << weights_type << "_group_size=" << group_size << "_transpose_b=" << transpose_b;
+        return result.str();
+    }
+};
+
+TEST_P(CompressMatMulWeightsTest, CompressesAndRestoresWeights) {
+    const auto& [weights_type, group_size, transpose_b] = GetParam();
+    const size_t OC = 32;
+    const size_t IC = 64;
+    const ov::Shape weights_shape = transpose_b ? ov::Shape{OC, IC} : ov::Shape{IC, OC};
+    std::vector<float> weights_values(OC * IC);
+    for (size_t i = 0; i < weights_values.size(); i++) {
+        weights_values[i] = std::sin(static_cast<float>(i)) * static_cast<float>(1 + i % 7);
+    }
+
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, IC});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, weights_shape, weights_values);
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(data, weights, false, transpose_b);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{data});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::InitNodeInfo>();
+    manager.register_pass<CompressMatMulWeights>(weights_type, group_size);
+    manager.run_passes(model);
+
+    auto new_matmul = ov::as_type_ptr<ov::op::v0::MatMul>(model->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(new_matmul, nullptr);
+    ASSERT_TRUE(new_matmul->get_transpose_b());
+
+    // the decompression subgraph is Convert -> [Subtract] -> Multiply -> [Reshape]
+    const bool grouped = group_size != 0 && group_size < IC && IC % group_size == 0;
+    auto decompression = new_matmul->get_input_node_shared_ptr(1);
+    if (grouped) {
+        ASSERT_TRUE(ov::is_type<ov::op::v1::Reshape>(decompression));
+        decompression = decompression->get_input_node_shared_ptr(0);
+    }
+    ASSERT_TRUE(ov::is_type<ov::op::v1::Multiply>(decompression));
+    decompression = decompression->get_input_node_shared_ptr(0);
+    ASSERT_EQ(ov::is_type<ov::op::v1::Subtract>(decompression), !weights_type.is_signed());
+    if (!weights_type.is_signed()) {
+        decompression = decompression->get_input_node_shared_ptr(0);
+    }
+    ASSERT_TRUE(ov::is_type<ov::op::v0::Convert>(decompression));
+    auto compressed = ov::as_type_ptr<ov::op::v0::Constant>(decompression->get_input_node_shared_ptr(0));
+    ASSERT_NE(compressed, nullptr);
+    ASSERT_EQ(compressed->get_element_type(), weights_type);
+    ASSERT_EQ(compressed->get_shape(),
+              grouped ? ov::Shape({OC, IC / group_size, group_size}) : ov::Shape({OC, IC}));
+
+    // the decompressed weights are within a quantization step of the original ones
+    auto restored = ov::util::get_constant_from_source(new_matmul->input_value(1));
+    ASSERT_NE(restored, nullptr);
+    ASSERT_EQ(restored->get_shape(), ov::Shape({OC, IC}));
+    const auto restored_values = restored->cast_vector<float>();
+    const float levels = weights_type.bitwidth() == 4 ? 7.F : 127.F;
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            const float original = transpose_b ? weights_values[oc * IC + ic] : weights_values[ic * OC + oc];
+            ASSERT_NEAR(restored_values[oc * IC + ic], original, 7.F / levels) << "oc " << oc << " ic " << ic;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TransformationTests,
+                         CompressMatMulWeightsTest,
+                         ::testing::Combine(::testing::Values(ov::element::u8,
+                                                              ov::element::i8,
+                                                              ov::element::u4,
+                                                              ov::element::i4),
+                                            ::testing::Values(0, 16, 48),
+                                            ::testing::Values(true, false)),
+                         CompressMatMulWeightsTest::getTestCaseName);
+
+TEST(TransformationTests, CompressMatMulWeightsSkipsNonConstantWeights) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto weights = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{16, 8});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(data, weights);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{data, weights});
+    auto model_ref = model->clone();
+
+    ov::pass::Manager manager;
+    manager.register_pass<CompressMatMulWeights>(ov::element::u4, 8);
+    manager.run_passes(model);
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, CompressMatMulWeightsSharesCompressedWeights) {
+    const size_t OC = 8;
+    const size_t IC = 16;
+    std::vector<float> weights_values(OC * IC);
+    for (size_t i = 0; i < weights_values.size(); i++) {
+        weights_values[i] = std::cos(static_cast<float>(i));
+    }
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, IC});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{OC, IC}, weights_values);
+    auto matmul_0 = std::make_shared<ov::op::v0::MatMul>(data, weights, false, true);
+    auto matmul_1 = std::make_shared<ov::op::v0::MatMul>(data, weights, false, true);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{matmul_0, matmul_1}, ov::ParameterVector{data});
+
+    ov::pass::Manager manager;
+    manager.register_pass<CompressMatMulWeights>(ov::element::u4, 8);
+    manager.run_passes(model);
+
+    size_t compressed_count = 0;
+    for (const auto& op : model->get_ops()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (constant && constant->get_shape() == ov::Shape({OC, IC / 8, 8})) {
+            compressed_count++;
+        }
+    }
+    ASSERT_EQ(compressed_count, 1U);
+    ASSERT_EQ(model->get_results()[0]->get_input_node_shared_ptr(0)->input_value(1),
+              model->get_results()[1]->get_input_node_shared_ptr(0)->input_value(1));
+}
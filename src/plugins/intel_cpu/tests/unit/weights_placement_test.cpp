@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "config.h"
+#include "openvino/runtime/threading/cpu_streams_info.hpp"
+#include "weights_placement.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// a single latency stream of 8 threads: 6 on the NUMA node 0 and 2 on the NUMA node 1
+const std::vector<std::vector<int>> crossNumaStreamsInfo = {{1, ov::ALL_PROC, 8, -1, -1},
+                                                            {0, ov::MAIN_CORE_PROC, 6, 0, 0},
+                                                            {0, ov::MAIN_CORE_PROC, 2, 1, 1}};
+
+void checkSlices(const WeightsPlacement& placement, uintptr_t base, size_t size) {
+    const auto* data = reinterpret_cast<const void*>(base);
+    const auto page = WeightsPlacement::pageSize();
+    size_t prevEnd = 0;
+    for (size_t i = 0; i < placement.numaNodes().size(); i++) {
+        const auto [begin, end] = placement.slice(data, size, i);
+        ASSERT_EQ(begin, prevEnd) << "numa node idx: " << i;
+        ASSERT_LE(begin, end) << "numa node idx: " << i;
+        if (begin != 0) {
+            ASSERT_EQ((base + begin) % page, 0U) << "numa node idx: " << i;
+        }
+        prevEnd = end;
+    }
+    ASSERT_EQ(prevEnd, size);
+}
+
+}  // namespace
+
+TEST(WeightsPlacementTest, CrossNumaStreamSpreadsWeights) {
+    const auto placement =
+        WeightsPlacement::create(crossNumaStreamsInfo, Config::WeightsNumaPlacement::Partition, 0, 0);
+    ASSERT_NE(placement, nullptr);
+    ASSERT_TRUE(placement->spreadsWeights());
+    ASSERT_EQ(placement->numaNodes(), (std::vector<int>{0, 1}));
+    ASSERT_EQ(placement->numaNodeThreads(), (std::vector<size_t>{6, 2}));
+}
+
+TEST(WeightsPlacementTest, NotSpreadWeights) {
+    // the weights stay on the NUMA node of the stream and aren't prefetched
+    ASSERT_EQ(WeightsPlacement::create(crossNumaStreamsInfo, Config::WeightsNumaPlacement::Stream, 0, 0), nullptr);
+    // the sub streams are placed on their own NUMA nodes
+    ASSERT_EQ(WeightsPlacement::create(crossNumaStreamsInfo, Config::WeightsNumaPlacement::Partition, 2, 0), nullptr);
+    const std::vector<std::vector<int>> singleNumaStreamsInfo = {{1, ov::MAIN_CORE_PROC, 8, 0, 0}};
+    ASSERT_EQ(WeightsPlacement::create(singleNumaStreamsInfo, Config::WeightsNumaPlacement::Partition, 0, 0),
+              nullptr);
+
+    const auto prefetchOnly =
+        WeightsPlacement::create(singleNumaStreamsInfo, Config::WeightsNumaPlacement::Partition, 0, 1024);
+    ASSERT_NE(prefetchOnly, nullptr);
+    ASSERT_FALSE(prefetchOnly->spreadsWeights());
+}
+
+TEST(WeightsPlacementTest, SlicesAreAlignedToAbsolutePages) {
+    const auto placement =
+        WeightsPlacement::create(crossNumaStreamsInfo, Config::WeightsNumaPlacement::Partition, 0, 0);
+    ASSERT_NE(placement, nullptr);
+    const auto page = WeightsPlacement::pageSize();
+    // the slices are only computed, the fake addresses are never accessed
+    for (const uintptr_t base : {page * 16, page * 16 + 64, page * 17 - 8}) {
+        for (const size_t size : {size_t{64}, page - 1, page * 3 + 100, page * 64}) {
+            checkSlices(*placement, base, size);
+        }
+    }
+    // the slice of the node 0 is the larger one for the large weights
+    const auto [begin, end] = placement->slice(reinterpret_cast<const void*>(page * 16 + 64), page * 64, 0);
+    ASSERT_EQ(begin, 0U);
+    ASSERT_EQ(end, page * 48 - 64);
+}
@@ -252,6 +252,43 @@ TEST_P(OVInferRequestBatchedTests, SetInputTensors_Multiple_Infer) {
     }
 }
 
+TEST_P(OVInferRequestBatchedTests, SetInputTensors_Adjacent_Multiple_Infer) {
+    size_t batch = 4;
+    auto one_shape = Shape{1, 2, 2, 2};
+    auto batch_shape = Shape{batch, 2, 2, 2};
+    auto one_shape_size = ov::shape_size(one_shape);
+    auto model = OVInferRequestBatchedTests::create_n_inputs(2, element::f32, batch_shape, "N...");
+    // 'user tensors' are the consecutive chunks of one buffer, plugin may use the buffer without copying
+    std::vector<float> buffer(one_shape_size * batch, 0);
+    auto execNet = ie->compile_model(model, target_device);
+    // Create InferRequest
+    ov::InferRequest req;
+    req = execNet.create_infer_request();
+    std::vector<ov::Tensor> tensors;
+    for (auto i = 0; i < batch; ++i) {
+        auto tensor = ov::Tensor(element::f32, one_shape, &buffer[i * one_shape_size]);
+        tensors.push_back(std::move(tensor));
+    }
+    req.set_tensors("tensor_input0", tensors);
+
+    for (auto testNum = 0; testNum < 3; testNum++) {
+        for (auto j = 0; j < one_shape_size * batch; ++j) {
+            buffer[j] = static_cast<float>(testNum + j);
+        }
+        req.infer(); // Adds '1' to each element
+        auto actual_tensor = req.get_tensor("tensor_output0");
+        auto* actual = actual_tensor.data<float>();
+        for (auto j = 0; j < one_shape_size * batch; ++j) {
+            EXPECT_EQ(actual[j], testNum + j + 1) << "Infer " << testNum << ": Expected=" << testNum + j + 1
+                                                  << ", actual=" << actual[j] << " for index " << j;
+        }
+    }
+    // the input is left unchanged
+    for (auto j = 0; j < one_shape_size * batch; ++j) {
+        EXPECT_EQ(buffer[j], 2 + j);
+    }
+}
+
 TEST_P(OVInferRequestBatchedTests, SetInputTensors_Can_Infer_Dynamic) {
     size_t batch = 4;
     auto one_shape = Shape{1, 2, 2, 2};
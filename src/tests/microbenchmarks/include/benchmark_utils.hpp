@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace test {
+namespace microbenchmark {
+
+/// @brief Formats the shape for a benchmark name, e.g. "1x3x224x224"
+inline std::string shape_to_string(const ov::Shape& shape) {
+    std::ostringstream out;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        out << (i == 0 ? "" : "x") << shape[i];
+    }
+    return out.str();
+}
+
+/// @brief Fills the tensor with reproducible random values in [-1, 1), integer tensors are filled with random bytes
+inline void fill_random(ov::Tensor& tensor, uint32_t seed = 1) {
+    std::mt19937 generator(seed);
+    const auto size = tensor.get_size();
+    switch (tensor.get_element_type()) {
+    case ov::element::f32: {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = distribution(generator);
+        }
+        break;
+    }
+    case ov::element::f16: {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        auto* data = tensor.data<ov::float16>();
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = ov::float16(distribution(generator));
+        }
+        break;
+    }
+    case ov::element::bf16: {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        auto* data = tensor.data<ov::bfloat16>();
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = ov::bfloat16(distribution(generator));
+        }
+        break;
+    }
+    default: {
+        std::uniform_int_distribution<int> distribution(0, 255);
+        auto* data = static_cast<uint8_t*>(tensor.data());
+        for (size_t i = 0; i < tensor.get_byte_size(); ++i) {
+            data[i] = static_cast<uint8_t>(distribution(generator));
+        }
+        break;
+    }
+    }
+}
+
+/// @brief Prevents the compiler from removing the computation of the value as unused
+template <class T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+}  // namespace microbenchmark
+}  // namespace test
+}  // namespace ov
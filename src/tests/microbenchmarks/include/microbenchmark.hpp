@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace test {
+namespace microbenchmark {
+
+/**
+ * @brief State of a running benchmark. The measured code is the body of the `while (state.keep_running())` loop,
+ * the code before the loop is the setup which isn't measured:
+ *
+ *     void bench_copy(State& state) {
+ *         ov::Tensor src(ov::element::f32, {1, 3, 224, 224}), dst(ov::element::f32, {1, 3, 224, 224});
+ *         while (state.keep_running()) {
+ *             src.copy_to(dst);
+ *         }
+ *         state.set_bytes_processed(src.get_byte_size());
+ *     }
+ */
+class State {
+public:
+    State(std::chrono::nanoseconds min_time, size_t min_iterations);
+
+    /// @brief Starts the timer on the first call and returns false when the measurement is over
+    bool keep_running();
+
+    /// @brief Sets the number of bytes processed by one iteration to report the throughput
+    void set_bytes_processed(size_t bytes) {
+        m_bytes_processed = bytes;
+    }
+
+    /// @brief Marks the benchmark as skipped, e.g. when the device doesn't support the benchmarked precision
+    void skip(const std::string& reason) {
+        m_skip_reason = reason;
+    }
+
+    size_t iterations() const {
+        return m_iterations;
+    }
+    std::chrono::nanoseconds elapsed() const {
+        return m_elapsed;
+    }
+    size_t bytes_processed() const {
+        return m_bytes_processed;
+    }
+    const std::string& skip_reason() const {
+        return m_skip_reason;
+    }
+
+private:
+    std::chrono::nanoseconds m_min_time;
+    size_t m_min_iterations;
+    size_t m_iterations = 0;
+    size_t m_bytes_processed = 0;
+    bool m_started = false;
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::nanoseconds m_elapsed{0};
+    std::string m_skip_reason;
+};
+
+using BenchmarkFunction = std::function<void(State&)>;
+
+/// @brief Registers a benchmark, parameterized benchmarks are registered once per parameters combination
+/// with the parameters encoded in the name, e.g. "Eltwise/Add/f32/1x64x56x56"
+void register_benchmark(const std::string& name, BenchmarkFunction function);
+
+/// @brief Registers benchmarks on the static initialization of the benchmarks translation units
+struct Registrar {
+    explicit Registrar(const std::function<void()>& register_benchmarks) {
+        register_benchmarks();
+    }
+};
+
+/// @brief Measurement of one benchmark
+struct Result {
+    std::string name;
+    size_t iterations = 0;
+    /// @brief Median time of one iteration over the repetitions
+    double time_ns = 0;
+    /// @brief Minimal time of one iteration over the repetitions
+    double min_time_ns = 0;
+    /// @brief Throughput computed from the median time, zero if the benchmark doesn't report processed bytes
+    double bytes_per_second = 0;
+    std::string skip_reason;
+};
+
+struct RunOptions {
+    /// @brief Regular expression, only the benchmarks whose names contain a match are run
+    std::string filter;
+    std::chrono::nanoseconds min_time = std::chrono::milliseconds(500);
+    size_t min_iterations = 1;
+    size_t repetitions = 3;
+};
+
+/// @brief Returns the names of the registered benchmarks matching the filter in the lexicographical order
+std::vector<std::string> list_benchmarks(const std::string& filter);
+
+/// @brief Runs the registered benchmarks in the lexicographical order of their names
+std::vector<Result> run_benchmarks(const RunOptions& options);
+
+/// @brief Serializes the results to JSON
+std::string to_json(const std::vector<Result>& results);
+
+/// @brief Reads the results serialized by to_json, e.g. a saved baseline
+std::vector<Result> from_json(const std::string& json);
+
+/// @brief Benchmark which became slower than in the baseline
+struct Regression {
+    std::string name;
+    double baseline_time_ns = 0;
+    double time_ns = 0;
+};
+
+/// @brief Finds the benchmarks whose median time exceeds the baseline one by more than the relative tolerance,
+/// the benchmarks missing in the baseline and the skipped ones are ignored
+std::vector<Regression> compare(const std::vector<Result>& baseline,
+                                const std::vector<Result>& results,
+                                double tolerance);
+
+}  // namespace microbenchmark
+}  // namespace test
+}  // namespace ov
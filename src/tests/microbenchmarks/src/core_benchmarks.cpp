@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "microbenchmark.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/reference/add.hpp"
+#include "openvino/reference/softmax.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace test {
+namespace microbenchmark {
+namespace {
+
+const std::vector<ov::Shape> tensor_shapes = {{1, 3, 224, 224}, {1, 64, 56, 56}, {1, 32, 1024, 128}};
+
+void register_tensor_benchmarks() {
+    for (const auto& element_type : {ov::element::f32, ov::element::u8}) {
+        for (const auto& shape : tensor_shapes) {
+            const auto suffix = element_type.get_type_name() + "/" + shape_to_string(shape);
+            register_benchmark("Tensor/copy_to/" + suffix, [=](State& state) {
+                ov::Tensor src(element_type, shape);
+                ov::Tensor dst(element_type, shape);
+                fill_random(src);
+                while (state.keep_running()) {
+                    src.copy_to(dst);
+                }
+                state.set_bytes_processed(src.get_byte_size());
+            });
+
+            // ROI of the half of the innermost dimension, the copy is strided
+            register_benchmark("Tensor/copy_to_roi/" + suffix, [=](State& state) {
+                ov::Tensor src(element_type, shape);
+                fill_random(src);
+                ov::Coordinate begin(shape.size(), 0);
+                ov::Coordinate end(shape);
+                end.back() = shape.back() / 2;
+                ov::Tensor roi(src, begin, end);
+                ov::Tensor dst(element_type, roi.get_shape());
+                while (state.keep_running()) {
+                    roi.copy_to(dst);
+                }
+                state.set_bytes_processed(dst.get_byte_size());
+            });
+        }
+    }
+}
+
+void register_hash_benchmarks() {
+    for (const size_t size : {size_t{4096}, size_t{1} << 20, size_t{64} << 20}) {
+        register_benchmark("compute_hash/" + std::to_string(size), [=](State& state) {
+            ov::Tensor data(ov::element::u8, {size});
+            fill_random(data);
+            size_t hash = 0;
+            while (state.keep_running()) {
+                hash += ov::runtime::compute_hash(data.data(), size);
+            }
+            do_not_optimize(hash);
+            state.set_bytes_processed(size);
+        });
+    }
+}
+
+void register_reference_benchmarks() {
+    for (const auto& shape : tensor_shapes) {
+        register_benchmark("reference/add/f32/" + shape_to_string(shape), [=](State& state) {
+            ov::Tensor a(ov::element::f32, shape), b(ov::element::f32, shape), out(ov::element::f32, shape);
+            fill_random(a);
+            fill_random(b);
+            while (state.keep_running()) {
+                ov::reference::add(a.data<float>(), b.data<float>(), out.data<float>(), a.get_size());
+            }
+            state.set_bytes_processed(3 * a.get_byte_size());
+        });
+
+        register_benchmark("reference/softmax/f32/" + shape_to_string(shape), [=](State& state) {
+            ov::Tensor in(ov::element::f32, shape), out(ov::element::f32, shape);
+            fill_random(in);
+            const ov::AxisSet axes{shape.size() - 1};
+            while (state.keep_running()) {
+                ov::reference::softmax(in.data<float>(), out.data<float>(), shape, axes);
+            }
+            state.set_bytes_processed(2 * in.get_byte_size());
+        });
+    }
+}
+
+void register_matcher_benchmarks() {
+    for (const size_t length : {size_t{100}, size_t{10000}}) {
+        register_benchmark("pattern/Matcher/relu_add_chain/" + std::to_string(length), [=](State& state) {
+            // a chain of Relu -> Add blocks, the pattern matches each Add
+            auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+            ov::Output<ov::Node> last = param;
+            for (size_t i = 0; i < length; ++i) {
+                auto relu = std::make_shared<ov::op::v0::Relu>(last);
+                last = std::make_shared<ov::op::v1::Add>(relu, last);
+            }
+            auto model = std::make_shared<ov::Model>(ov::OutputVector{last}, ov::ParameterVector{param});
+
+            auto pattern = ov::pass::pattern::wrap_type<ov::op::v1::Add>(
+                {ov::pass::pattern::wrap_type<ov::op::v0::Relu>(), ov::pass::pattern::any_input()});
+            auto matcher = std::make_shared<ov::pass::pattern::Matcher>(pattern, "ReluAdd");
+            const auto nodes = model->get_ordered_ops();
+            size_t matched = 0;
+            while (state.keep_running()) {
+                for (const auto& node : nodes) {
+                    matched += matcher->match(node->output(0)) ? 1 : 0;
+                    matcher->clear_state();
+                }
+            }
+            do_not_optimize(matched);
+        });
+    }
+}
+
+const Registrar registrar([] {
+    register_tensor_benchmarks();
+    register_hash_benchmarks();
+    register_reference_benchmarks();
+    register_matcher_benchmarks();
+});
+
+}  // namespace
+}  // namespace microbenchmark
+}  // namespace test
+}  // namespace ov
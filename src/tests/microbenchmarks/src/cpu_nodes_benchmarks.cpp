@@ -0,0 +1,253 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "microbenchmark.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace test {
+namespace microbenchmark {
+namespace {
+
+using InputsInitializer = std::function<void(ov::InferRequest&)>;
+
+ov::Core& get_core() {
+    static ov::Core core;
+    return core;
+}
+
+bool is_precision_supported(const ov::element::Type& precision) {
+    if (precision == ov::element::f32) {
+        return true;
+    }
+    const auto capabilities = get_core().get_property("CPU", ov::device::capabilities);
+    const auto capability = precision == ov::element::bf16 ? ov::device::capability::BF16 : ov::device::capability::FP16;
+    return std::find(capabilities.begin(), capabilities.end(), capability) != capabilities.end();
+}
+
+// Measures the inference of a single-node model, the inputs are filled with random values unless an initializer is
+// passed. The model is compiled in the latency mode so the node uses all the cores like in a single-stream pipeline.
+void run_model(State& state,
+               const std::shared_ptr<ov::Model>& model,
+               const ov::element::Type& inference_precision,
+               const InputsInitializer& init_inputs = {}) {
+    if (!is_precision_supported(inference_precision)) {
+        state.skip(inference_precision.get_type_name() + " is not supported by the CPU");
+        return;
+    }
+    auto compiled_model = get_core().compile_model(model,
+                                                   "CPU",
+                                                   ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                                   ov::hint::inference_precision(inference_precision));
+    auto request = compiled_model.create_infer_request();
+    size_t bytes = 0;
+    for (const auto& input : compiled_model.inputs()) {
+        auto tensor = request.get_tensor(input);
+        fill_random(tensor);
+        bytes += tensor.get_byte_size();
+    }
+    for (const auto& output : compiled_model.outputs()) {
+        bytes += request.get_tensor(output).get_byte_size();
+    }
+    if (init_inputs) {
+        init_inputs(request);
+    }
+    // the first inference initializes the primitives and the caches
+    request.infer();
+    while (state.keep_running()) {
+        request.infer();
+    }
+    state.set_bytes_processed(bytes);
+}
+
+std::string name_suffix(const ov::element::Type& precision, const ov::Shape& shape) {
+    return precision.get_type_name() + "/" + shape_to_string(shape);
+}
+
+void register_eltwise_benchmarks() {
+    for (const auto& precision : {ov::element::f32, ov::element::bf16}) {
+        for (const auto& shape : {ov::Shape{1, 64, 56, 56}, ov::Shape{1, 1024, 4096}}) {
+            register_benchmark("CPU/Eltwise/Add/" + name_suffix(precision, shape), [=](State& state) {
+                auto a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+                auto b = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+                auto add = std::make_shared<ov::op::v1::Add>(a, b);
+                run_model(state, std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{a, b}), precision);
+            });
+            register_benchmark("CPU/Eltwise/MultiplyBroadcast/" + name_suffix(precision, shape), [=](State& state) {
+                auto a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+                ov::Shape scale_shape(shape.size(), 1);
+                scale_shape[1] = shape[1];
+                auto scale = ov::op::v0::Constant::create(ov::element::f32,
+                                                          scale_shape,
+                                                          std::vector<float>(ov::shape_size(scale_shape), 0.5f));
+                auto mul = std::make_shared<ov::op::v1::Multiply>(a, scale);
+                run_model(state, std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{a}), precision);
+            });
+        }
+    }
+}
+
+// MatMul with the weights decompressed from u8/u4 with per output channel scales and zero points,
+// the CPU plugin fuses the decompression into the FullyConnected node
+std::shared_ptr<ov::Model> make_compressed_fc(const ov::element::Type& weights_type, size_t m, size_t k, size_t n) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, m, k});
+
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> distribution(0, weights_type == ov::element::u4 ? 15 : 255);
+    std::vector<uint8_t> weights_values(n * k);
+    std::generate(weights_values.begin(), weights_values.end(), [&]() {
+        return static_cast<uint8_t>(distribution(generator));
+    });
+    auto weights = ov::op::v0::Constant::create(weights_type, ov::Shape{n, k}, weights_values);
+    auto zero_point = ov::op::v0::Constant::create(weights_type, ov::Shape{n, 1}, std::vector<uint8_t>(n, 8));
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{n, 1}, std::vector<float>(n, 0.01f));
+
+    auto weights_f32 = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+    auto zero_point_f32 = std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32);
+    auto shifted = std::make_shared<ov::op::v1::Subtract>(weights_f32, zero_point_f32);
+    auto scaled = std::make_shared<ov::op::v1::Multiply>(shifted, scale);
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(data, scaled, false, true);
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{data});
+}
+
+void register_fc_benchmarks() {
+    constexpr size_t k = 4096;
+    constexpr size_t n = 4096;
+    for (const auto& weights_type : {ov::element::u8, ov::element::u4}) {
+        for (const auto& precision : {ov::element::f32, ov::element::bf16}) {
+            // token generation and prompt processing
+            for (const size_t m : {size_t{1}, size_t{128}}) {
+                const auto name = "CPU/FullyConnected/compressed_" + weights_type.get_type_name() + "/" +
+                                  name_suffix(precision, {m, k, n});
+                register_benchmark(name, [=](State& state) {
+                    run_model(state, make_compressed_fc(weights_type, m, k, n), precision);
+                });
+            }
+        }
+    }
+}
+
+void register_sdpa_benchmarks() {
+    constexpr size_t heads = 32;
+    constexpr size_t head_size = 128;
+    for (const auto& precision : {ov::element::f32, ov::element::bf16}) {
+        // a generated token attending to the context and the prompt processing
+        for (const auto& lengths : std::vector<std::pair<size_t, size_t>>{{1, 1024}, {1024, 1024}}) {
+            const ov::Shape q_shape{1, heads, lengths.first, head_size};
+            const ov::Shape kv_shape{1, heads, lengths.second, head_size};
+            const auto name = "CPU/ScaledDotProductAttention/" + name_suffix(precision, q_shape) + "/kv" +
+                              std::to_string(lengths.second);
+            register_benchmark(name, [=](State& state) {
+                auto q = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, q_shape);
+                auto k = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, kv_shape);
+                auto v = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, kv_shape);
+                auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q, k, v, lengths.first > 1);
+                run_model(state,
+                          std::make_shared<ov::Model>(ov::OutputVector{sdpa}, ov::ParameterVector{q, k, v}),
+                          precision);
+            });
+        }
+    }
+}
+
+void register_transpose_benchmarks() {
+    // the CPU Transpose node is executed by the permute kernel shared with Reorder
+    for (const auto& precision : {ov::element::f32, ov::element::bf16}) {
+        const ov::Shape shape{1, 64, 112, 112};
+        register_benchmark("CPU/Transpose/nchw_to_nhwc/" + name_suffix(precision, shape), [=](State& state) {
+            auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+            auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 3, 1});
+            auto transpose = std::make_shared<ov::op::v1::Transpose>(data, order);
+            run_model(state,
+                      std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{data}),
+                      precision);
+        });
+    }
+}
+
+void register_gather_benchmarks() {
+    // embeddings lookup
+    constexpr size_t vocabulary = 8192;
+    constexpr size_t hidden = 2048;
+    for (const size_t tokens : {size_t{1}, size_t{512}}) {
+        register_benchmark("CPU/Gather/embeddings/f32/" + std::to_string(vocabulary) + "x" + std::to_string(hidden) +
+                               "/tokens" + std::to_string(tokens),
+                           [=](State& state) {
+                               auto table = ov::op::v0::Constant::create(ov::element::f32,
+                                                                         ov::Shape{vocabulary, hidden},
+                                                                         std::vector<float>(vocabulary * hidden, 0.5f));
+                               auto indices =
+                                   std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{1, tokens});
+                               auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+                               auto gather = std::make_shared<ov::op::v8::Gather>(table, indices, axis);
+                               auto model = std::make_shared<ov::Model>(ov::OutputVector{gather},
+                                                                        ov::ParameterVector{indices});
+                               run_model(state, model, ov::element::f32, [=](ov::InferRequest& request) {
+                                   auto tensor = request.get_input_tensor();
+                                   std::mt19937 generator(1);
+                                   std::uniform_int_distribution<int32_t> distribution(0, vocabulary - 1);
+                                   auto* data = tensor.data<int32_t>();
+                                   for (size_t i = 0; i < tensor.get_size(); ++i) {
+                                       data[i] = distribution(generator);
+                                   }
+                               });
+                           });
+    }
+}
+
+void register_reduce_benchmarks() {
+    for (const auto& precision : {ov::element::f32, ov::element::bf16}) {
+        const ov::Shape spatial_shape{1, 256, 56, 56};
+        register_benchmark("CPU/Reduce/Mean_spatial/" + name_suffix(precision, spatial_shape), [=](State& state) {
+            auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, spatial_shape);
+            auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {2, 3});
+            auto reduce = std::make_shared<ov::op::v1::ReduceMean>(data, axes, true);
+            run_model(state, std::make_shared<ov::Model>(ov::OutputVector{reduce}, ov::ParameterVector{data}), precision);
+        });
+        const ov::Shape rows_shape{1, 1024, 4096};
+        register_benchmark("CPU/Reduce/Sum_innermost/" + name_suffix(precision, rows_shape), [=](State& state) {
+            auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, rows_shape);
+            auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {2});
+            auto reduce = std::make_shared<ov::op::v1::ReduceSum>(data, axes, true);
+            run_model(state, std::make_shared<ov::Model>(ov::OutputVector{reduce}, ov::ParameterVector{data}), precision);
+        });
+    }
+}
+
+const Registrar registrar([] {
+    register_eltwise_benchmarks();
+    register_fc_benchmarks();
+    register_sdpa_benchmarks();
+    register_transpose_benchmarks();
+    register_gather_benchmarks();
+    register_reduce_benchmarks();
+});
+
+}  // namespace
+}  // namespace microbenchmark
+}  // namespace test
+}  // namespace ov
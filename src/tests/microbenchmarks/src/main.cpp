@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "microbenchmark.hpp"
+
+namespace {
+
+void print_usage() {
+    std::cout << "Usage: ov_microbenchmarks [options]\n"
+              << "    --filter <regex>        run only the benchmarks whose names match the regular expression\n"
+              << "    --min_time <ms>         minimal measurement time of a repetition, 500 by default\n"
+              << "    --repetitions <n>       number of the measurement repetitions, 3 by default\n"
+              << "    --json <path>           write the results to the JSON file\n"
+              << "    --baseline <path>       compare the results with the JSON file of a previous run\n"
+              << "    --tolerance <fraction>  allowed relative slowdown against the baseline, 0.1 by default\n"
+              << "    --list                  print the names of the benchmarks and exit\n";
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Can't open " + path);
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    using namespace ov::test::microbenchmark;
+    try {
+        RunOptions options;
+        std::string json_path;
+        std::string baseline_path;
+        double tolerance = 0.1;
+        bool list_only = false;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::runtime_error("Missing value of " + arg);
+                }
+                return argv[++i];
+            };
+            if (arg == "--filter") {
+                options.filter = value();
+            } else if (arg == "--min_time") {
+                options.min_time = std::chrono::milliseconds(std::stoll(value()));
+            } else if (arg == "--repetitions") {
+                options.repetitions = std::stoul(value());
+            } else if (arg == "--json") {
+                json_path = value();
+            } else if (arg == "--baseline") {
+                baseline_path = value();
+            } else if (arg == "--tolerance") {
+                tolerance = std::stod(value());
+            } else if (arg == "--list") {
+                list_only = true;
+            } else if (arg == "--help" || arg == "-h") {
+                print_usage();
+                return EXIT_SUCCESS;
+            } else {
+                print_usage();
+                throw std::runtime_error("Unknown option " + arg);
+            }
+        }
+
+        if (list_only) {
+            for (const auto& name : list_benchmarks(options.filter)) {
+                std::cout << name << "\n";
+            }
+            return EXIT_SUCCESS;
+        }
+        const auto results = run_benchmarks(options);
+
+        for (const auto& result : results) {
+            std::cout << std::left << std::setw(64) << result.name;
+            if (!result.skip_reason.empty()) {
+                std::cout << "skipped: " << result.skip_reason << "\n";
+            } else {
+                std::cout << std::right << std::setw(14) << std::fixed << std::setprecision(1) << result.time_ns
+                          << " ns" << std::setw(12) << result.iterations << " iterations";
+                if (result.bytes_per_second != 0) {
+                    std::cout << std::setw(10) << std::setprecision(2) << result.bytes_per_second / 1e9 << " GB/s";
+                }
+                std::cout << "\n";
+            }
+        }
+        if (!json_path.empty()) {
+            std::ofstream(json_path) << to_json(results);
+        }
+
+        if (!baseline_path.empty()) {
+            const auto regressions = compare(from_json(read_file(baseline_path)), results, tolerance);
+            for (const auto& regression : regressions) {
+                std::cout << "REGRESSION " << regression.name << ": " << std::fixed << std::setprecision(1)
+                          << regression.baseline_time_ns << " ns -> " << regression.time_ns << " ns\n";
+            }
+            if (!regressions.empty()) {
+                return EXIT_FAILURE;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
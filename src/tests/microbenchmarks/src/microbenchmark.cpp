@@ -0,0 +1,163 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "microbenchmark.hpp"
+
+#include <algorithm>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <regex>
+#include <unordered_map>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace test {
+namespace microbenchmark {
+namespace {
+
+std::map<std::string, BenchmarkFunction>& registry() {
+    static std::map<std::string, BenchmarkFunction> benchmarks;
+    return benchmarks;
+}
+
+}  // namespace
+
+State::State(std::chrono::nanoseconds min_time, size_t min_iterations)
+    : m_min_time(min_time),
+      m_min_iterations(std::max<size_t>(min_iterations, 1)) {}
+
+bool State::keep_running() {
+    if (!m_skip_reason.empty()) {
+        return false;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (!m_started) {
+        m_started = true;
+        m_start = now;
+        return true;
+    }
+    ++m_iterations;
+    m_elapsed = now - m_start;
+    return m_iterations < m_min_iterations || m_elapsed < m_min_time;
+}
+
+void register_benchmark(const std::string& name, BenchmarkFunction function) {
+    const auto inserted = registry().emplace(name, std::move(function)).second;
+    OPENVINO_ASSERT(inserted, "Benchmark ", name, " is registered twice");
+}
+
+std::vector<std::string> list_benchmarks(const std::string& filter) {
+    const std::regex filter_regex(filter);
+    std::vector<std::string> names;
+    for (const auto& benchmark : registry()) {
+        if (filter.empty() || std::regex_search(benchmark.first, filter_regex)) {
+            names.push_back(benchmark.first);
+        }
+    }
+    return names;
+}
+
+std::vector<Result> run_benchmarks(const RunOptions& options) {
+    OPENVINO_ASSERT(options.repetitions > 0, "The number of the benchmark repetitions must be positive");
+    std::vector<Result> results;
+    for (const auto& name : list_benchmarks(options.filter)) {
+        const auto benchmark = registry().find(name);
+        Result result;
+        result.name = name;
+        std::vector<double> times;
+        size_t bytes_processed = 0;
+        for (size_t repetition = 0; repetition < options.repetitions; ++repetition) {
+            State state(options.min_time, options.min_iterations);
+            benchmark->second(state);
+            if (!state.skip_reason().empty()) {
+                result.skip_reason = state.skip_reason();
+                break;
+            }
+            OPENVINO_ASSERT(state.iterations() > 0, "Benchmark ", name, " doesn't run the measured loop");
+            result.iterations += state.iterations();
+            times.push_back(static_cast<double>(state.elapsed().count()) / static_cast<double>(state.iterations()));
+            bytes_processed = state.bytes_processed();
+        }
+        if (result.skip_reason.empty()) {
+            std::sort(times.begin(), times.end());
+            result.time_ns = times[times.size() / 2];
+            result.min_time_ns = times.front();
+            if (bytes_processed != 0 && result.time_ns > 0) {
+                result.bytes_per_second = static_cast<double>(bytes_processed) * 1e9 / result.time_ns;
+            }
+        }
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+std::string to_json(const std::vector<Result>& results) {
+    auto benchmarks = nlohmann::json::array();
+    for (const auto& result : results) {
+        nlohmann::json benchmark = {{"name", result.name}};
+        if (!result.skip_reason.empty()) {
+            benchmark["skipped"] = result.skip_reason;
+        } else {
+            benchmark["iterations"] = result.iterations;
+            benchmark["time_ns"] = result.time_ns;
+            benchmark["min_time_ns"] = result.min_time_ns;
+            if (result.bytes_per_second != 0) {
+                benchmark["bytes_per_second"] = result.bytes_per_second;
+            }
+        }
+        benchmarks.push_back(std::move(benchmark));
+    }
+    return nlohmann::json{{"benchmarks", std::move(benchmarks)}}.dump(2);
+}
+
+std::vector<Result> from_json(const std::string& json) {
+    std::vector<Result> results;
+    try {
+        const auto parsed = nlohmann::json::parse(json);
+        for (const auto& benchmark : parsed.at("benchmarks")) {
+            Result result;
+            result.name = benchmark.at("name").get<std::string>();
+            result.skip_reason = benchmark.value("skipped", std::string{});
+            result.iterations = benchmark.value("iterations", size_t{0});
+            result.time_ns = benchmark.value("time_ns", 0.0);
+            result.min_time_ns = benchmark.value("min_time_ns", 0.0);
+            result.bytes_per_second = benchmark.value("bytes_per_second", 0.0);
+            results.push_back(std::move(result));
+        }
+    } catch (const nlohmann::json::exception& e) {
+        OPENVINO_THROW("Failed to read the benchmark results: ", e.what());
+    }
+    return results;
+}
+
+std::vector<Regression> compare(const std::vector<Result>& baseline,
+                                const std::vector<Result>& results,
+                                double tolerance) {
+    OPENVINO_ASSERT(tolerance >= 0, "The tolerance of the benchmarks comparison can't be negative");
+    std::unordered_map<std::string, const Result*> baseline_index;
+    for (const auto& result : baseline) {
+        if (result.skip_reason.empty()) {
+            baseline_index.emplace(result.name, &result);
+        }
+    }
+
+    std::vector<Regression> regressions;
+    for (const auto& result : results) {
+        const auto it = baseline_index.find(result.name);
+        if (!result.skip_reason.empty() || it == baseline_index.end()) {
+            continue;
+        }
+        const auto baseline_time = it->second->time_ns;
+        if (result.time_ns > baseline_time * (1.0 + tolerance)) {
+            regressions.push_back({result.name, baseline_time, result.time_ns});
+        }
+    }
+    return regressions;
+}
+
+}  // namespace microbenchmark
+}  // namespace test
+}  // namespace ov